@@ -60,20 +60,13 @@
 #endif
 #endif
 
-#ifndef _swap_uint16_t
-#define _swap_uint16_t(a, b)                                                   \
-  {                                                                            \
-    uint16_t t = a;                                                            \
-    a = b;                                                                     \
-    b = t;                                                                     \
-  } ///< Swap contents of two uint16_t variables
-#endif
-
 // Constructor for single matrix w/hardware SPI:
 Adafruit_DotStarMatrix::Adafruit_DotStarMatrix(int w, int h, uint8_t matrixType,
                                                uint8_t ledType)
     : Adafruit_GFX(w, h), Adafruit_DotStar(w * h, ledType), type(matrixType),
-      matrixWidth(w), matrixHeight(h), tilesX(0), tilesY(0), remapFn(NULL) {}
+      matrixWidth(w), matrixHeight(h), tilesX(0), tilesY(0), remapFn(NULL),
+      rByte(ledType & 3), gByte((ledType >> 2) & 3),
+      bByte((ledType >> 4) & 3), ownPixels(numPixels()) {}
 
 // Constructor for single matrix w/bitbang SPI:
 Adafruit_DotStarMatrix::Adafruit_DotStarMatrix(int w, int h, uint8_t d,
@@ -81,7 +74,8 @@ Adafruit_DotStarMatrix::Adafruit_DotStarMatrix(int w, int h, uint8_t d,
                                                uint8_t ledType)
     : Adafruit_GFX(w, h), Adafruit_DotStar(w * h, d, c, ledType),
       type(matrixType), matrixWidth(w), matrixHeight(h), tilesX(0), tilesY(0),
-      remapFn(NULL) {}
+      remapFn(NULL), rByte(ledType & 3), gByte((ledType >> 2) & 3),
+      bByte((ledType >> 4) & 3), ownPixels(numPixels()) {}
 
 // Constructor for tiled matrices w/hardware SPI:
 Adafruit_DotStarMatrix::Adafruit_DotStarMatrix(uint8_t mW, uint8_t mH,
@@ -90,8 +84,9 @@ Adafruit_DotStarMatrix::Adafruit_DotStarMatrix(uint8_t mW, uint8_t mH,
                                                uint8_t ledType)
     : Adafruit_GFX(mW * tX, mH * tY),
       Adafruit_DotStar(mW * mH * tX * tY, ledType), type(matrixType),
-      matrixWidth(mW), matrixHeight(mH), tilesX(tX), tilesY(tY), remapFn(NULL) {
-}
+      matrixWidth(mW), matrixHeight(mH), tilesX(tX), tilesY(tY), remapFn(NULL),
+      rByte(ledType & 3), gByte((ledType >> 2) & 3),
+      bByte((ledType >> 4) & 3), ownPixels(numPixels()) {}
 
 // Constructor for tiled matrices w/bitbang SPI:
 Adafruit_DotStarMatrix::Adafruit_DotStarMatrix(uint8_t mW, uint8_t mH,
@@ -101,7 +96,95 @@ Adafruit_DotStarMatrix::Adafruit_DotStarMatrix(uint8_t mW, uint8_t mH,
                                                uint8_t ledType)
     : Adafruit_GFX(mW * tX, mH * tY),
       Adafruit_DotStar(mW * mH * tX * tY, d, c, ledType), type(matrixType),
-      matrixWidth(mW), matrixHeight(mH), tilesX(tX), tilesY(tY), remapFn(NULL) {
+      matrixWidth(mW), matrixHeight(mH), tilesX(tX), tilesY(tY), remapFn(NULL),
+      rByte(ledType & 3), gByte((ledType >> 2) & 3),
+      bByte((ledType >> 4) & 3), ownPixels(numPixels()) {}
+
+// Constructor for single matrix sharing another's strip:
+Adafruit_DotStarMatrix::Adafruit_DotStarMatrix(Adafruit_DotStarMatrix &s,
+                                               uint16_t first, int w, int h,
+                                               uint8_t matrixType)
+    : Adafruit_GFX(w, h), Adafruit_DotStar(0), type(matrixType),
+      matrixWidth(w), matrixHeight(h), tilesX(0), tilesY(0), remapFn(NULL),
+      rByte(s.rByte), gByte(s.gByte), bByte(s.bByte) {
+  attach(s, first);
+}
+
+// Constructor for tiled matrices sharing another's strip:
+Adafruit_DotStarMatrix::Adafruit_DotStarMatrix(Adafruit_DotStarMatrix &s,
+                                               uint16_t first, uint8_t mW,
+                                               uint8_t mH, uint8_t tX,
+                                               uint8_t tY, uint8_t matrixType)
+    : Adafruit_GFX(mW * tX, mH * tY), Adafruit_DotStar(0), type(matrixType),
+      matrixWidth(mW), matrixHeight(mH), tilesX(tX), tilesY(tY), remapFn(NULL),
+      rByte(s.rByte), gByte(s.gByte), bByte(s.bByte) {
+  attach(s, first);
+}
+
+// Point a view at its range of the owning matrix's strip, growing that
+// strip's buffer to include it if needed.
+void Adafruit_DotStarMatrix::attach(Adafruit_DotStarMatrix &s,
+                                    uint16_t first) {
+  if (s.strip) { // View of a view, go straight to the owner
+    first += s.stripOffset;
+    strip = s.strip;
+  } else {
+    strip = &s;
+  }
+  stripOffset = first;
+  stripLength = WIDTH * HEIGHT;
+  uint32_t end = (uint32_t)first + stripLength;
+  if (end > strip->numPixels()) {
+    uint16_t old = strip->numPixels();
+    strip->updateLength(end); // Reallocates and clears
+    strip->powerSum = 0;
+    strip->growCalibration(old);
+  }
+}
+
+Adafruit_DotStarMatrix::~Adafruit_DotStarMatrix(void) {
+  free(dlist);
+  free(calib);
+  free(corrMap);
+  free(calibCopy);
+  free(symTable);
+}
+
+bool Adafruit_DotStarMatrix::setLayout(int w, int h, uint8_t matrixType) {
+  return changeLayout(w, h, w, h, 0, 0, matrixType);
+}
+
+bool Adafruit_DotStarMatrix::setLayout(uint8_t mW, uint8_t mH, uint8_t tX,
+                                       uint8_t tY, uint8_t matrixType) {
+  return changeLayout(mW * tX, mH * tY, mW, mH, tX, tY, matrixType);
+}
+
+// Common to both setLayout()s: w, h are overall size in pixels, tX, tY
+// are 0 for a single matrix (same as constructors).
+bool Adafruit_DotStarMatrix::changeLayout(int16_t w, int16_t h, uint8_t mW,
+                                          uint8_t mH, uint8_t tX, uint8_t tY,
+                                          uint8_t matrixType) {
+  uint32_t n = (uint32_t)w * h;
+  uint16_t avail = strip ? stripLength : ownPixels; // Not views' LEDs
+  if ((w <= 0) || (h <= 0) || (n > avail))
+    return false;
+
+  flushDisplayList(); // Pending commands are in old coordinates
+  if (calib && ((tX ? (tX * tY) : 1) != numTiles()))
+    clearCalibration(); // Per-tile data no longer lines up
+
+  for (uint16_t i = n; i < avail; i++) // Unused LEDs go dark
+    setPixelColor(i, 0);
+
+  type = matrixType;
+  matrixWidth = mW;
+  matrixHeight = mH;
+  tilesX = tX;
+  tilesY = tY;
+  WIDTH = w;
+  HEIGHT = h;
+  setRotation(rotation); // Recalculate _width, _height
+  return true;
 }
 
 // Expand 16-bit input color (Adafruit_GFX colorspace) to 24-bit (DotStar)
@@ -112,6 +195,107 @@ static uint32_t expandColor(uint16_t color) {
          pgm_read_byte(&gamma5[color & 0x1F]);
 }
 
+// GFX color to the 24-bit value written to the strip
+uint32_t Adafruit_DotStarMatrix::color32(uint16_t color) const {
+  return passThruFlag ? passThruColor : expandColor(color);
+}
+
+// Sum of R, G and B components of a packed color
+static inline uint16_t channelSum(uint32_t c) {
+  return ((c >> 16) & 0xFF) + ((c >> 8) & 0xFF) + (c & 0xFF);
+}
+
+// Strip index of an unrotated pixel, updated as it moves one pixel at a
+// time. Within a tile, a step along a line of LEDs is +/-1; a step to the
+// next line is +/-majorScale (progressive) or a reflection about the line
+// end (zigzag). Only entering another tile needs the full remap.
+struct DSCursor {
+  DSCursor(uint8_t t, uint8_t w, uint8_t h, uint8_t tx, uint8_t ty)
+      : type(t), mW(w), mH(h), tX(tx), tY(ty), x(-1), y(-1) {}
+  uint8_t type, mW, mH, tX, tY;   // Layout, as for dsMatrixRemap()
+  int16_t x, y;                   // Current pixel
+  int16_t left, top;              // Its tile's top-left pixel
+  uint16_t index;                 // Its strip index
+  uint16_t tileOffset, lineStart; // Index of tile's, line's first pixel
+  uint16_t lineLen;               // Pixels per line (majorScale)
+  int8_t minorDir, majorDir;      // Index/line change per +1 along axis
+};
+
+static inline uint16_t cursorRemap(const DSCursor &c, int16_t x, int16_t y) {
+  return dsMatrixRemap(c.type, c.mW, c.mH, c.tX, c.tY, x, y);
+}
+
+// Full remap, and find how the index moves within this pixel's tile by
+// probing a neighbor along each axis.
+static void cursorMoveTo(DSCursor &c, int16_t x, int16_t y) {
+  bool rows = (c.type & DS_MATRIX_AXIS) == DS_MATRIX_ROWS;
+  c.x = x;
+  c.y = y;
+  c.left = x - x % c.mW;
+  c.top = y - y % c.mH;
+  c.index = cursorRemap(c, x, y);
+  c.tileOffset = c.index - c.index % ((uint16_t)c.mW * c.mH);
+  c.lineLen = rows ? c.mW : c.mH;
+  c.lineStart = c.index - c.tileOffset;
+  c.lineStart -= c.lineStart % c.lineLen;
+
+  for (uint8_t axis = 0; axis < 2; axis++) { // x, then y
+    int16_t len = axis ? c.mH : c.mW, pos = axis ? (y - c.top) : (x - c.left);
+    if (len < 2)
+      continue; // Never steps within the tile along this axis
+    int8_t sgn = ((pos + 1) < len) ? 1 : -1; // At tile edge, look back
+    uint16_t n = axis ? cursorRemap(c, x, y + sgn) : cursorRemap(c, x + sgn, y);
+    if (rows == !axis) { // Neighbor on same line
+      c.minorDir = ((n > c.index) ? 1 : -1) * sgn;
+    } else { // Neighbor on adjacent line
+      n -= c.tileOffset;
+      c.majorDir = ((n < c.lineStart) ? -1 : 1) * sgn;
+    }
+  }
+}
+
+// Move one pixel along x (dx = +/-1) or y (dy = +/-1)
+static void cursorStep(DSCursor &c, int8_t dx, int8_t dy) {
+  c.x += dx;
+  c.y += dy;
+  if ((c.x < c.left) || (c.x >= (c.left + c.mW)) || (c.y < c.top) ||
+      (c.y >= (c.top + c.mH))) {
+    cursorMoveTo(c, c.x, c.y);
+    return;
+  }
+  bool rows = (c.type & DS_MATRIX_AXIS) == DS_MATRIX_ROWS;
+  int8_t minor = rows ? dx : dy, major = (rows ? dy : dx) * c.majorDir;
+  if (minor) {
+    c.index += minor * c.minorDir;
+  } else if ((c.type & DS_MATRIX_SEQUENCE) == DS_MATRIX_PROGRESSIVE) {
+    c.index += major * (int16_t)c.lineLen;
+    c.lineStart += major * (int16_t)c.lineLen;
+  } else { // Zigzag: same position counted from the other end
+    uint16_t local = c.index - c.tileOffset;
+    if (major > 0) {
+      local = 2 * (c.lineStart + c.lineLen) - 1 - local;
+      c.lineStart += c.lineLen;
+    } else {
+      local = 2 * c.lineStart - 1 - local;
+      c.lineStart -= c.lineLen;
+    }
+    c.index = c.tileOffset + local;
+    c.minorDir = -c.minorDir;
+  }
+}
+
+// Move to x, y: a single step if that's next to the current pixel (as
+// when walking a row or column), else a full remap
+static uint16_t cursorTo(DSCursor &c, int16_t x, int16_t y) {
+  int16_t dx = x - c.x, dy = y - c.y;
+  if ((!dy && ((dx == 1) || (dx == -1))) ||
+      (!dx && ((dy == 1) || (dy == -1))))
+    cursorStep(c, dx, dy);
+  else if (dx || dy)
+    cursorMoveTo(c, x, y);
+  return c.index;
+}
+
 // Downgrade 24-bit color to 16-bit (add reverse gamma lookup here?)
 uint16_t Adafruit_DotStarMatrix::Color(uint8_t r, uint8_t g, uint8_t b) {
   return ((uint16_t)(r & 0xF8) << 8) | ((uint16_t)(g & 0xFC) << 3) | (b >> 3);
@@ -128,9 +312,63 @@ void Adafruit_DotStarMatrix::setPassThruColor(void) { passThruFlag = false; }
 
 void Adafruit_DotStarMatrix::drawPixel(int16_t x, int16_t y, uint16_t color) {
 
-  if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+  if (fillBlock(x, y, 1, 1, color)) // Display list or scaled
     return;
 
+  x -= viewX; // Virtual canvas to screen coordinates
+  y -= viewY;
+  if (clipW) { // Redrawing part of screen after panViewport()
+    if ((x < clipX) || (y < clipY) || (x >= (clipX + clipW)) ||
+        (y >= (clipY + clipH)))
+      return;
+  } else if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) {
+    return;
+  }
+
+  uint32_t c = color32(color);
+  if (symTable) {
+    unrotate(x, y);
+    writeXY(x, y, c);
+  } else {
+    setPixelColor(remapRotated(x, y), c);
+  }
+}
+
+// Adafruit_GFX culls characters against the screen, 0 to _width, in the
+// coordinates it's given, so in virtual canvas coordinates anything past
+// the first screenful would never be drawn. Text is drawn in screen
+// coordinates instead, with the viewport offset set aside meanwhile.
+void Adafruit_DotStarMatrix::drawChar(int16_t x, int16_t y, unsigned char c,
+                                      uint16_t color, uint16_t bg,
+                                      uint8_t size) {
+  drawChar(x, y, c, color, bg, size, size);
+}
+
+void Adafruit_DotStarMatrix::drawChar(int16_t x, int16_t y, unsigned char c,
+                                      uint16_t color, uint16_t bg,
+                                      uint8_t size_x, uint8_t size_y) {
+  int16_t vx = viewX, vy = viewY;
+  viewX = viewY = 0;
+  Adafruit_GFX::drawChar(x - vx, y - vy, c, color, bg, size_x, size_y);
+  viewX = vx;
+  viewY = vy;
+}
+
+size_t Adafruit_DotStarMatrix::write(uint8_t c) {
+  int16_t vx = viewX, vy = viewY;
+  viewX = viewY = 0;
+  cursor_x -= vx;
+  cursor_y -= vy;
+  size_t n = Adafruit_GFX::write(c);
+  cursor_x += vx;
+  cursor_y += vy;
+  viewX = vx;
+  viewY = vy;
+  return n;
+}
+
+// Convert rotated X/Y (already clipped to _width, _height) to unrotated
+void Adafruit_DotStarMatrix::unrotate(int16_t &x, int16_t &y) const {
   int16_t t;
   switch (rotation) {
   case 1:
@@ -148,105 +386,1574 @@ void Adafruit_DotStarMatrix::drawPixel(int16_t x, int16_t y, uint16_t color) {
     y = HEIGHT - 1 - t;
     break;
   }
+}
 
-  int tileOffset = 0, pixelOffset;
+// Convert rotated rect (already clipped) to unrotated
+void Adafruit_DotStarMatrix::unrotateRect(int16_t &x, int16_t &y, int16_t &w,
+                                          int16_t &h) const {
+  int16_t t;
+  switch (rotation) {
+  case 1:
+    t = x;
+    x = WIDTH - y - h;
+    y = t;
+    t = w;
+    w = h;
+    h = t;
+    break;
+  case 2:
+    x = WIDTH - x - w;
+    y = HEIGHT - y - h;
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = HEIGHT - t - w;
+    t = w;
+    w = h;
+    h = t;
+    break;
+  }
+}
 
-  if (remapFn) { // Custom X/Y remapping function
-    pixelOffset = (*remapFn)(x, y);
-  } else { // Standard single matrix or tiled matrices
+// Map rotated X/Y (already clipped to _width, _height) to pixel index
+uint16_t Adafruit_DotStarMatrix::remapRotated(int16_t x, int16_t y) {
+  unrotate(x, y);
+  return remap(x, y);
+}
 
-    uint8_t corner = type & DS_MATRIX_CORNER;
-    uint16_t minor, major, majorScale;
+// Set pixel at unrotated X/Y to a 24-bit color, along with its mirror
+// images if a symmetry mode is active.
+void Adafruit_DotStarMatrix::writeXY(int16_t x, int16_t y, uint32_t c) {
+  if (!symTable) {
+    setPixelColor(remap(x, y), c);
+    return;
+  }
+  // Fold into the top-left region and write every strip index listed
+  // for it (the list includes this pixel itself)
+  if ((symFold & DS_MIRROR_X) && (x >= symW))
+    x = WIDTH - 1 - x;
+  if ((symFold & DS_MIRROR_Y) && (y >= symH))
+    y = HEIGHT - 1 - y;
+  const uint16_t *t = &symTable[(y * symW + x) * symCount];
+  for (uint8_t i = 0; i < symCount; i++)
+    setPixelColor(t[i], c);
+}
+
+void Adafruit_DotStarMatrix::setScale(uint8_t sx, uint8_t sy) {
+  flushDisplayList(); // Queued drawing is in the old scale
+  scaleX = sx ? sx : 1;
+  scaleY = sy ? sy : 1;
+  setRotation(rotation); // Recalculate _width, _height
+}
 
-    if (tilesX) { // Tiled display, multiple matrices
-      uint16_t tile;
+bool Adafruit_DotStarMatrix::setSymmetry(uint8_t mode) {
+  flushDisplayList(); // Already-queued drawing isn't mirrored
+  symmetry = mode;
+  return buildSymmetry();
+}
 
-      minor = x / matrixWidth;           // Tile # X/Y; presume row major to
-      major = y / matrixHeight,          // start (will swap later if needed)
-          x = x - (minor * matrixWidth); // Pixel X/Y within tile
-      y = y - (major * matrixHeight);    // (-* is less math than modulo)
+void Adafruit_DotStarMatrix::setRotation(uint8_t r) {
+  Adafruit_GFX::setRotation(r);
+  _width /= scaleX; // Logical size when scaling up
+  _height /= scaleY;
+  if (symmetry) // Screen X and Y axes may have swapped
+    buildSymmetry();
+}
 
-      // Determine corner of entry, flip axes if needed
-      if (type & DS_TILE_RIGHT)
-        minor = tilesX - 1 - minor;
-      if (type & DS_TILE_BOTTOM)
-        major = tilesY - 1 - major;
+// (Re)build the table of mirror image strip indices for each pixel of
+// the top-left region, which is all that writeXY() ever looks up. Built
+// in unrotated coordinates, so screen-relative mirror axes are swapped
+// for 90 and 270 degree rotations.
+bool Adafruit_DotStarMatrix::buildSymmetry(void) {
+  free(symTable);
+  symTable = NULL;
+  uint8_t fold = symmetry;
+  if (rotation & 1) // Swap X and Y bits
+    fold = (fold & ~DS_MIRROR_XY) | ((fold & DS_MIRROR_X) << 1) |
+           ((fold & DS_MIRROR_Y) >> 1);
+  if ((fold != DS_KALEIDOSCOPE) || (WIDTH != HEIGHT))
+    fold &= DS_MIRROR_XY; // Diagonal only for full 4-way on a square
+  if (!fold)
+    return true;
+
+  symFold = fold;
+  symW = (fold & DS_MIRROR_X) ? ((WIDTH + 1) / 2) : WIDTH;
+  symH = (fold & DS_MIRROR_Y) ? ((HEIGHT + 1) / 2) : HEIGHT;
+  symCount = (fold == DS_KALEIDOSCOPE) ? 8 : (fold == DS_MIRROR_XY) ? 4 : 2;
+  symTable = (uint16_t *)malloc(symW * symH * symCount * sizeof(uint16_t));
+  if (!symTable)
+    return false;
+
+  uint16_t *t = symTable;
+  for (int16_t y = 0; y < symH; y++) {
+    for (int16_t x = 0; x < symW; x++) {
+      int16_t mx = WIDTH - 1 - x, my = HEIGHT - 1 - y;
+      *t++ = remap(x, y);
+      if (fold & DS_MIRROR_X)
+        *t++ = remap(mx, y);
+      if (fold & DS_MIRROR_Y)
+        *t++ = remap(x, my);
+      if ((fold & DS_MIRROR_XY) == DS_MIRROR_XY)
+        *t++ = remap(mx, my);
+      if (fold == DS_KALEIDOSCOPE) { // Same again, reflected on diagonal
+        *t++ = remap(y, x);
+        *t++ = remap(my, x);
+        *t++ = remap(y, mx);
+        *t++ = remap(my, mx);
+      }
+    }
+  }
+  return true;
+}
+
+// Map unrotated X/Y (0 to WIDTH-1, 0 to HEIGHT-1) to absolute pixel index
+uint16_t Adafruit_DotStarMatrix::remap(uint16_t x, uint16_t y) {
+  if (remapFn) // Custom X/Y remapping function
+    return (*remapFn)(x, y);
+  // Standard single matrix or tiled matrices
+  return dsMatrixRemap(type, matrixWidth, matrixHeight, tilesX, tilesY, x, y);
+}
+
+void Adafruit_DotStarMatrix::fillScreen(uint16_t color) {
+  uint16_t i, n;
+  uint32_t c;
+
+  if (clipW) { // Redrawing part of screen after panViewport()
+    fillRect(clipX + viewX, clipY + viewY, clipW, clipH, color);
+    return;
+  }
+
+  dlistCount = 0; // Covers everything queued so far, so discard it all
+  if (fillBlock(viewX, viewY, _width, _height, color))
+    return;
+
+  c = color32(color);
+  n = WIDTH * HEIGHT; // Not numPixels(), layout may be smaller (setLayout())
+  for (i = 0; i < n; i++)
+    setPixelColor(i, c);
+}
+
+void Adafruit_DotStarMatrix::setRemapFunction(uint16_t (*fn)(uint16_t,
+                                                             uint16_t)) {
+  remapFn = fn;
+  if (symmetry)
+    buildSymmetry();
+}
 
-      // Determine actual major axis of tiling
-      if ((type & DS_TILE_AXIS) == DS_TILE_ROWS) {
-        majorScale = tilesX;
+void Adafruit_DotStarMatrix::drawPaletteRow(int16_t x, int16_t y,
+                                            const uint8_t *idx, int16_t w,
+                                            const uint32_t *palette,
+                                            int16_t transparent) {
+  drawRow(x, y, w, idx, palette, transparent);
+}
+
+// Shared by drawPaletteRow() and the image blits: a run of packed colors,
+// either looked up through idx or (if idx is NULL) taken from colors
+// directly, in which case nothing is transparent.
+void Adafruit_DotStarMatrix::drawRow(int16_t x, int16_t y, int16_t w,
+                                     const uint8_t *idx,
+                                     const uint32_t *colors,
+                                     int16_t transparent) {
+  flushDisplayList(); // Writes directly, keep drawing order intact
+  int16_t left = x - viewX, h = 1;
+  if (!toScreen(x, y, w, h))
+    return;
+  if (idx)
+    idx += x - left; // Skip any pixels clipped off the left
+  else
+    colors += x - left;
+
+  if ((scaleX > 1) || (scaleY > 1)) { // Each pixel is a block
+    for (; w--; x++) {
+      uint32_t c;
+      if (idx) {
+        uint8_t i = *idx++;
+        if (i == transparent)
+          continue;
+        c = colors[i];
       } else {
-        _swap_uint16_t(major, minor);
-        majorScale = tilesY;
+        c = *colors++;
       }
+      int16_t bx = x * scaleX, by = y * scaleY, bw = scaleX, bh = scaleY;
+      unrotateRect(bx, by, bw, bh);
+      fillUnrotated(bx, by, bw, bh, c);
+    }
+    return;
+  }
 
-      // Determine tile number
-      if ((type & DS_TILE_SEQUENCE) == DS_TILE_PROGRESSIVE) {
-        // All tiles in same order
-        tile = major * majorScale + minor;
+  // Rotate the starting point once; successive pixels along a logical
+  // row then step by one along a single physical axis.
+  int16_t px, py, dx = 0, dy = 0;
+  switch (rotation) {
+  case 0:
+    px = x;
+    py = y;
+    dx = 1;
+    break;
+  case 1:
+    px = WIDTH - 1 - y;
+    py = x;
+    dy = 1;
+    break;
+  case 2:
+    px = WIDTH - 1 - x;
+    py = HEIGHT - 1 - y;
+    dx = -1;
+    break;
+  default:
+    px = y;
+    py = HEIGHT - 1 - x;
+    dy = -1;
+    break;
+  }
+
+  if (!idx) {
+    while (w-- > 0) {
+      writeXY(px, py, *colors++);
+      px += dx;
+      py += dy;
+    }
+    return;
+  }
+  while (w-- > 0) {
+    uint8_t i = *idx++;
+    if (i != transparent)
+      writeXY(px, py, colors[i]);
+    px += dx;
+    py += dy;
+  }
+}
+
+// One updateRegion() source pixel as a 24-bit color
+uint32_t Adafruit_DotStarMatrix::regionColor(const uint8_t *p, uint8_t format,
+                                             const uint32_t *palette) const {
+  switch (format) {
+  case DS_REGION_565:
+    return color32(*(const uint16_t *)p);
+  case DS_REGION_888:
+    return ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+  case DS_REGION_PALETTE:
+    return palette[*p];
+  default: // DS_REGION_RAW
+    return ((uint32_t)p[rByte] << 16) | ((uint32_t)p[gByte] << 8) | p[bByte];
+  }
+}
+
+// Copy raw pixels to consecutive strip indices from n, straight into the
+// pixel buffer (the owner's, for a view), keeping the power total right
+void Adafruit_DotStarMatrix::copyRaw(uint16_t n, const uint8_t *src,
+                                     uint16_t len) {
+  Adafruit_DotStarMatrix *m = this;
+  if (strip) {
+    if (n >= stripLength)
+      return;
+    if (len > (stripLength - n))
+      len = stripLength - n;
+    n += stripOffset;
+    m = strip;
+  }
+  if (n >= m->numPixels())
+    return;
+  if (len > (m->numPixels() - n))
+    len = m->numPixels() - n;
+  uint8_t *dst = m->getPixels() + n * 3;
+  if (m->powerLimit) {
+    for (uint16_t i = 0; i < len * 3; i++)
+      m->powerSum += (int16_t)src[i] - dst[i];
+  }
+  memcpy(dst, src, len * 3);
+}
+
+// Clip once, then walk each row with the strip-index cursor. Raw pixels
+// are gathered into runs while the index goes up by one per pixel, and
+// each run is a single copy.
+void Adafruit_DotStarMatrix::updateRegion(int16_t x, int16_t y, int16_t w,
+                                          int16_t h, const void *buf,
+                                          uint8_t format,
+                                          const uint32_t *palette) {
+  flushDisplayList(); // Writes directly, keep drawing order intact
+  int16_t left = x - viewX, top = y - viewY, stride = w;
+  if (!toScreen(x, y, w, h))
+    return;
+  uint8_t bpp = (format == DS_REGION_565)       ? 2
+                : (format == DS_REGION_PALETTE) ? 1
+                                                : 3;
+  const uint8_t *row = (const uint8_t *)buf +
+                       ((int32_t)(y - top) * stride + (x - left)) * bpp;
+  bool scaled = (scaleX > 1) || (scaleY > 1),
+       direct = !scaled && !symTable && !remapFn,
+       raw = direct && ((format == DS_REGION_RAW) ||
+                        ((format == DS_REGION_888) && !rByte &&
+                         (gByte == 1) && (bByte == 2)));
+
+  DSCursor cur(type, matrixWidth, matrixHeight, tilesX, tilesY);
+  for (int16_t j = 0; j < h; j++, row += (int32_t)stride * bpp) {
+    const uint8_t *p = row, *runSrc = NULL;
+    uint16_t runStart = 0, runLen = 0;
+    for (int16_t i = 0; i < w; i++, p += bpp) {
+      int16_t px = x + i, py = y + j;
+      if (scaled) { // Each pixel is a block
+        int16_t bw = scaleX, bh = scaleY;
+        px *= scaleX;
+        py *= scaleY;
+        unrotateRect(px, py, bw, bh);
+        fillUnrotated(px, py, bw, bh, regionColor(p, format, palette));
+        continue;
+      }
+      unrotate(px, py);
+      if (!direct) { // Symmetry or custom remapping
+        writeXY(px, py, regionColor(p, format, palette));
+        continue;
+      }
+      uint16_t n = cursorTo(cur, px, py);
+      if (!raw) {
+        setPixelColor(n, regionColor(p, format, palette));
+      } else if (runLen && (n == (runStart + runLen))) {
+        runLen++;
       } else {
-        // Zigzag; alternate rows change direction.  On these rows,
-        // this also flips the starting corner of the matrix for the
-        // pixel math later.
-        if (major & 1) {
-          corner ^= DS_MATRIX_CORNER;
-          tile = (major + 1) * majorScale - 1 - minor;
-        } else {
-          tile = major * majorScale + minor;
+        if (runLen)
+          copyRaw(runStart, runSrc, runLen);
+        runStart = n;
+        runSrc = p;
+        runLen = 1;
+      }
+    }
+    if (runLen)
+      copyRaw(runStart, runSrc, runLen);
+  }
+}
+
+void Adafruit_DotStarMatrix::drawScaledRGBBitmap(int16_t x, int16_t y,
+                                                 const uint16_t *bitmap,
+                                                 int16_t srcW, int16_t srcH,
+                                                 int16_t w, int16_t h,
+                                                 bool linear) {
+  downsample(x, y, NULL, bitmap, srcW, srcH, w, h, linear);
+}
+
+void Adafruit_DotStarMatrix::drawScaledRGBBitmap(int16_t x, int16_t y,
+                                                 const uint8_t *rgb,
+                                                 int16_t srcW, int16_t srcH,
+                                                 int16_t w, int16_t h,
+                                                 bool linear) {
+  downsample(x, y, rgb, NULL, srcW, srcH, w, h, linear);
+}
+
+// Box filter: each output pixel is the average of the block of source
+// pixels it covers (or, when enlarging, the one source pixel it falls in).
+// Source rows are read once, in order, summing into one row of per-column
+// accumulators; each finished row goes out through drawRow().
+void Adafruit_DotStarMatrix::downsample(int16_t x, int16_t y,
+                                        const uint8_t *rgb,
+                                        const uint16_t *rgb565, int16_t srcW,
+                                        int16_t srcH, int16_t w, int16_t h,
+                                        bool linear) {
+  if ((srcW <= 0) || (srcH <= 0) || (w <= 0) || (h <= 0))
+    return;
+  uint32_t *acc = (uint32_t *)malloc(w * 3 * sizeof(uint32_t));
+  if (!acc)
+    return;
+  // Column boundaries step by srcW / w with a Bresenham-style remainder,
+  // so there's no division per source pixel.
+  int16_t colStep = srcW / w, colRem = srcW % w;
+
+  for (int16_t ty = 0; ty < h; ty++) {
+    int16_t sy = (int32_t)ty * srcH / h, syEnd = (int32_t)(ty + 1) * srcH / h;
+    if (syEnd <= sy)
+      syEnd = sy + 1;
+    int16_t sy0 = sy, ry = y + ty - viewY;
+    if ((ry < 0) || (ry >= _height))
+      continue; // Row is off screen, don't bother reading it
+
+    memset(acc, 0, w * 3 * sizeof(uint32_t));
+    for (; sy < syEnd; sy++) {
+      const uint16_t *row565 = rgb565 ? &rgb565[(int32_t)sy * srcW] : NULL;
+      const uint8_t *row888 = rgb ? &rgb[(int32_t)sy * srcW * 3] : NULL;
+      uint32_t *a = acc;
+      int16_t sx = 0, sxEnd = 0, err = 0;
+      for (int16_t tx = 0; tx < w; tx++, a += 3) {
+        sxEnd += colStep;
+        if ((err += colRem) >= w) {
+          err -= w;
+          sxEnd++;
+        }
+        // Block is [sx, sxEnd), or just sx if enlarging
+        int16_t stop = (sxEnd > sx) ? sxEnd : sx + 1;
+        for (int16_t i = sx; i < stop; i++) {
+          uint8_t r, g, b;
+          if (row565) {
+            uint16_t c = row565[i];
+            if (linear) { // gamma5/6 map straight to linear PWM levels
+              r = pgm_read_byte(&gamma5[c >> 11]);
+              g = pgm_read_byte(&gamma6[(c >> 5) & 0x3F]);
+              b = pgm_read_byte(&gamma5[c & 0x1F]);
+            } else {
+              r = ((c >> 8) & 0xF8) | (c >> 13);
+              g = ((c >> 3) & 0xFC) | ((c >> 9) & 0x03);
+              b = ((c << 3) & 0xF8) | ((c >> 2) & 0x07);
+            }
+          } else {
+            const uint8_t *p = &row888[i * 3];
+            r = p[0];
+            g = p[1];
+            b = p[2];
+            if (linear) {
+              r = Adafruit_DotStar::gamma8(r);
+              g = Adafruit_DotStar::gamma8(g);
+              b = Adafruit_DotStar::gamma8(b);
+            }
+          }
+          a[0] += r;
+          a[1] += g;
+          a[2] += b;
         }
+        sx = sxEnd;
+      }
+    }
+
+    // Divide out and pack, in place (pixel tx only overwrites slots that
+    // earlier pixels have finished with). Linear sums are already PWM
+    // levels; otherwise the average gets the usual gamma correction.
+    int16_t sxEnd = 0, err = 0, sx = 0;
+    for (int16_t tx = 0; tx < w; tx++) {
+      sxEnd += colStep;
+      if ((err += colRem) >= w) {
+        err -= w;
+        sxEnd++;
+      }
+      uint32_t n = (uint32_t)((sxEnd > sx) ? sxEnd - sx : 1) * (syEnd - sy0);
+      sx = sxEnd;
+      uint8_t r = (acc[tx * 3] + n / 2) / n, g = (acc[tx * 3 + 1] + n / 2) / n,
+              b = (acc[tx * 3 + 2] + n / 2) / n;
+      if (!linear) {
+        r = Adafruit_DotStar::gamma8(r);
+        g = Adafruit_DotStar::gamma8(g);
+        b = Adafruit_DotStar::gamma8(b);
+      }
+      acc[tx] = ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+    drawRow(x, y + ty, w, NULL, acc, -1);
+  }
+  free(acc);
+}
+
+// Bilinear sample of a '565' image at 16.16 position (u, v), measured from
+// the top-left corner of pixel 0,0; returns an ungamma'd 24-bit color.
+// Edge pixels extend outward. Neighbors matching colorkey take the
+// nearest pixel's color instead, so keyed areas don't bleed in.
+static uint32_t bilinear565(const uint16_t *bitmap, int16_t srcW,
+                            int16_t srcH, int32_t u, int32_t v,
+                            uint16_t nearest, int32_t colorkey) {
+  u -= 0x8000; // Pixel centers
+  v -= 0x8000;
+  int16_t x0 = u >> 16, ya = v >> 16, x1 = x0 + 1, yb = ya + 1;
+  uint16_t fx = (u >> 8) & 0xFF, fy = (v >> 8) & 0xFF;
+  if (x0 < 0)
+    x0 = 0;
+  if (x1 >= srcW)
+    x1 = srcW - 1;
+  if (ya < 0)
+    ya = 0;
+  if (yb >= srcH)
+    yb = srcH - 1;
+  uint16_t c[4] = {bitmap[(int32_t)ya * srcW + x0],
+                   bitmap[(int32_t)ya * srcW + x1],
+                   bitmap[(int32_t)yb * srcW + x0],
+                   bitmap[(int32_t)yb * srcW + x1]};
+  uint32_t out = 0;
+  for (uint8_t i = 0; i < 4; i++) {
+    if (c[i] == colorkey)
+      c[i] = nearest;
+  }
+  for (uint8_t shift = 0; shift < 24; shift += 8) {
+    uint16_t p[4];
+    for (uint8_t i = 0; i < 4; i++) { // Expand one channel to 8 bits
+      uint16_t k = c[i];
+      if (shift == 16)
+        p[i] = ((k >> 8) & 0xF8) | (k >> 13);
+      else if (shift == 8)
+        p[i] = ((k >> 3) & 0xFC) | ((k >> 9) & 0x03);
+      else
+        p[i] = ((k << 3) & 0xF8) | ((k >> 2) & 0x07);
+    }
+    uint32_t top = p[0] * (256 - fx) + p[1] * fx,
+             bot = p[2] * (256 - fx) + p[3] * fx;
+    uint8_t ch = (top * (256 - fy) + bot * fy + 0x8000) >> 16;
+    out |= (uint32_t)Adafruit_DotStar::gamma8(ch) << shift;
+  }
+  return out;
+}
+
+void Adafruit_DotStarMatrix::drawRotoZoom(int16_t cx, int16_t cy,
+                                          const uint16_t *bitmap,
+                                          int16_t srcW, int16_t srcH,
+                                          float angle, float zoom,
+                                          bool bilinear, int32_t colorkey) {
+  if ((srcW <= 0) || (srcH <= 0) || (zoom <= 0.0))
+    return;
+  if (zoom < DS_ROTOZOOM_MIN) // Keeps 16.16 steps in range
+    zoom = DS_ROTOZOOM_MIN;
+
+  // All the trig happens here, once. Source position for each screen
+  // pixel is then an affine function of x and y, stepped in 16.16 fixed
+  // point: +x adds (dudx, dvdx), +y adds (dudy, dvdy).
+  float rad = angle * (float)(M_PI / 180.0), sn = sin(rad), cs = cos(rad);
+  int32_t dudx = (int32_t)(cs / zoom * 65536.0),
+          dvdx = (int32_t)(-sn / zoom * 65536.0),
+          dudy = (int32_t)(sn / zoom * 65536.0),
+          dvdy = (int32_t)(cs / zoom * 65536.0);
+
+  // Bounding box of the rotated image, clipped to the visible area. At
+  // large zooms it can be far bigger than int16_t, so it's limited first
+  // and clipped in 32 bits.
+  float as = (sn < 0) ? -sn : sn, ac = (cs < 0) ? -cs : cs,
+        fw = (ac * srcW + as * srcH) * zoom * 0.5,
+        fh = (as * srcW + ac * srcH) * zoom * 0.5;
+  int32_t hw = ((fw < 65536.0) ? (int32_t)fw : 65536) + 1,
+          hh = ((fh < 65536.0) ? (int32_t)fh : 65536) + 1;
+  int32_t xl = (int32_t)cx - hw, xr = (int32_t)cx + hw,
+          yt = (int32_t)cy - hh, yb = (int32_t)cy + hh;
+  if (xl < viewX)
+    xl = viewX;
+  if (xr > (int32_t)viewX + _width)
+    xr = (int32_t)viewX + _width;
+  if (yt < viewY)
+    yt = viewY;
+  if (yb > (int32_t)viewY + _height)
+    yb = (int32_t)viewY + _height;
+  if ((xl >= xr) || (yt >= yb))
+    return;
+  int16_t left = xl, right = xr, top = yt, bottom = yb;
+
+  uint32_t *span = (uint32_t *)malloc((right - left) * sizeof(uint32_t));
+  if (!span)
+    return;
+
+  // Source position at the center of pixel (left, top); screen point
+  // (cx, cy) lands on the center of the image.
+  float ox = (left - cx + 0.5) / zoom, oy = (top - cy + 0.5) / zoom;
+  int32_t uRow = (int32_t)((srcW * 0.5 + ox * cs + oy * sn) * 65536.0),
+          vRow = (int32_t)((srcH * 0.5 - ox * sn + oy * cs) * 65536.0);
+  uint32_t uMax = (uint32_t)srcW << 16, vMax = (uint32_t)srcH << 16;
+
+  for (int16_t y = top; y < bottom; y++, uRow += dudy, vRow += dvdy) {
+    int32_t u = uRow, v = vRow;
+    int16_t run = 0; // Opaque pixels pending in span[]
+    for (int16_t x = left; x < right; x++, u += dudx, v += dvdx) {
+      bool opaque = ((uint32_t)u < uMax) && ((uint32_t)v < vMax);
+      if (opaque) {
+        uint16_t c = bitmap[(int32_t)(v >> 16) * srcW + (u >> 16)];
+        if (c == colorkey)
+          opaque = false;
+        else
+          span[run++] = bilinear
+                            ? bilinear565(bitmap, srcW, srcH, u, v, c, colorkey)
+                            : expandColor(c);
+      }
+      if (!opaque && run) { // Gap: write out the span that just ended
+        drawRow(x - run, y, run, NULL, span, -1);
+        run = 0;
+      }
+    }
+    if (run)
+      drawRow(right - run, y, run, NULL, span, -1);
+  }
+  free(span);
+}
+
+// Filled shapes: same spans as Adafruit_GFX, but each is a single
+// fillSpan() in a color expanded once per shape, rather than a line drawn
+// through drawPixel().
+
+void Adafruit_DotStarMatrix::fillCircle(int16_t cx, int16_t cy, int16_t r,
+                                        uint16_t color) {
+  uint32_t c = color32(color);
+  fillSpan(cx, cy - r, 1, 2 * r + 1, c);
+  fillCircleSpans(cx, cy, r, 3, 0, c);
+}
+
+// Left (corners & 2) and/or right (corners & 1) halves of a filled circle
+// as vertical spans, stretched by delta pixels (for rounded rects)
+void Adafruit_DotStarMatrix::fillCircleSpans(int16_t cx, int16_t cy,
+                                             int16_t r, uint8_t corners,
+                                             int16_t delta, uint32_t c) {
+  int16_t f = 1 - r, ddx = 1, ddy = -2 * r, x = 0, y = r, px = x, py = y;
+  delta++;
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddy += 2;
+      f += ddy;
+    }
+    x++;
+    ddx += 2;
+    f += ddx;
+    if (x < (y + 1)) { // Avoid double-drawing certain lines
+      if (corners & 1)
+        fillSpan(cx + x, cy - y, 1, 2 * y + delta, c);
+      if (corners & 2)
+        fillSpan(cx - x, cy - y, 1, 2 * y + delta, c);
+    }
+    if (y != py) {
+      if (corners & 1)
+        fillSpan(cx + py, cy - px, 1, 2 * px + delta, c);
+      if (corners & 2)
+        fillSpan(cx - py, cy - px, 1, 2 * px + delta, c);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+void Adafruit_DotStarMatrix::fillRoundRect(int16_t x, int16_t y, int16_t w,
+                                           int16_t h, int16_t r,
+                                           uint16_t color) {
+  int16_t maxRadius = ((w < h) ? w : h) / 2; // 1/2 minor axis
+  if (r > maxRadius)
+    r = maxRadius;
+  uint32_t c = color32(color);
+  fillSpan(x + r, y, w - 2 * r, h, c);
+  fillCircleSpans(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, c);
+  fillCircleSpans(x + r, y + r, r, 2, h - 2 * r - 1, c);
+}
+
+void Adafruit_DotStarMatrix::fillTriangle(int16_t xa, int16_t ya, int16_t xb,
+                                          int16_t yb, int16_t xc, int16_t yc,
+                                          uint16_t color) {
+  uint32_t c = color32(color);
+  int16_t a, b, y, last, t;
+
+  // Sort corners by Y (yc >= yb >= ya)
+  if (ya > yb) {
+    t = ya, ya = yb, yb = t;
+    t = xa, xa = xb, xb = t;
+  }
+  if (yb > yc) {
+    t = yc, yc = yb, yb = t;
+    t = xc, xc = xb, xb = t;
+  }
+  if (ya > yb) {
+    t = ya, ya = yb, yb = t;
+    t = xa, xa = xb, xb = t;
+  }
+
+  if (ya == yc) { // All on same line, span from leftmost to rightmost
+    a = b = xa;
+    if (xb < a)
+      a = xb;
+    else if (xb > b)
+      b = xb;
+    if (xc < a)
+      a = xc;
+    else if (xc > b)
+      b = xc;
+    fillSpan(a, ya, b - a + 1, 1, c);
+    return;
+  }
+
+  int16_t dxab = xb - xa, dyab = yb - ya, dxac = xc - xa, dyac = yc - ya,
+          dxbc = xc - xb, dybc = yc - yb;
+  int32_t sa = 0, sb = 0;
+
+  // Upper part: spans from edge a-b to edge a-c. Includes row yb if the
+  // lower part is flat (yb == yc), else that row is left to it.
+  last = (yb == yc) ? yb : yb - 1;
+  for (y = ya; y <= last; y++) {
+    a = xa + sa / dyab;
+    b = xa + sb / dyac;
+    sa += dxab;
+    sb += dxac;
+    if (a > b) {
+      t = a, a = b, b = t;
+    }
+    fillSpan(a, y, b - a + 1, 1, c);
+  }
+
+  // Lower part: spans from edge b-c to edge a-c
+  sa = (int32_t)dxbc * (y - yb);
+  sb = (int32_t)dxac * (y - ya);
+  for (; y <= yc; y++) {
+    a = xb + sa / dybc;
+    b = xa + sb / dyac;
+    sa += dxbc;
+    sb += dxac;
+    if (a > b) {
+      t = a, a = b, b = t;
+    }
+    fillSpan(a, y, b - a + 1, 1, c);
+  }
+}
+
+void Adafruit_DotStarMatrix::fillRect(int16_t x, int16_t y, int16_t w,
+                                      int16_t h, uint16_t color) {
+  fillSpan(x, y, w, h, color32(color));
+}
+
+void Adafruit_DotStarMatrix::writeFillRect(int16_t x, int16_t y, int16_t w,
+                                           int16_t h, uint16_t color) {
+  fillSpan(x, y, w, h, color32(color));
+}
+
+void Adafruit_DotStarMatrix::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                           uint16_t color) {
+  if (w < 0) { // Lines may be given right-to-left or bottom-to-top
+    x += w + 1;
+    w = -w;
+  } else if (!w) {
+    return;
+  }
+  fillSpan(x, y, w, 1, color32(color));
+}
+
+void Adafruit_DotStarMatrix::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                           uint16_t color) {
+  if (h < 0) { // Lines may be given right-to-left or bottom-to-top
+    y += h + 1;
+    h = -h;
+  } else if (!h) {
+    return;
+  }
+  fillSpan(x, y, 1, h, color32(color));
+}
+
+void Adafruit_DotStarMatrix::writeFastHLine(int16_t x, int16_t y, int16_t w,
+                                            uint16_t color) {
+  if (w < 0) { // Lines may be given right-to-left or bottom-to-top
+    x += w + 1;
+    w = -w;
+  } else if (!w) {
+    return;
+  }
+  fillSpan(x, y, w, 1, color32(color));
+}
+
+void Adafruit_DotStarMatrix::writeFastVLine(int16_t x, int16_t y, int16_t h,
+                                            uint16_t color) {
+  if (h < 0) { // Lines may be given right-to-left or bottom-to-top
+    y += h + 1;
+    h = -h;
+  } else if (!h) {
+    return;
+  }
+  fillSpan(x, y, 1, h, color32(color));
+}
+
+// Physical step for a one-pixel step on screen, at a given rotation
+static void unrotateStep(uint8_t rotation, int8_t &dx, int8_t &dy) {
+  int8_t t;
+  switch (rotation) {
+  case 1:
+    t = dx;
+    dx = -dy;
+    dy = t;
+    break;
+  case 2:
+    dx = -dx;
+    dy = -dy;
+    break;
+  case 3:
+    t = dx;
+    dx = dy;
+    dy = -t;
+    break;
+  }
+}
+
+// Same Bresenham steps as Adafruit_GFX (so the same pixels), but rather
+// than mapping each point from scratch, follow the strip index along.
+void Adafruit_DotStarMatrix::writeLine(int16_t xa, int16_t ya, int16_t xb,
+                                       int16_t yb, uint16_t color) {
+  if (dlist || (scaleX > 1) || (scaleY > 1) || symTable || remapFn) {
+    Adafruit_GFX::writeLine(xa, ya, xb, yb, color); // Pixel at a time
+    return;
+  }
+
+  int16_t left = clipW ? clipX : 0, top = clipW ? clipY : 0;
+  int16_t right = clipW ? (clipX + clipW) : _width;
+  int16_t bottom = clipW ? (clipY + clipH) : _height;
+  int16_t t;
+  bool steep = abs(yb - ya) > abs(xb - xa);
+  if (steep) {
+    t = xa, xa = ya, ya = t;
+    t = xb, xb = yb, yb = t;
+  }
+  if (xa > xb) {
+    t = xa, xa = xb, xb = t;
+    t = ya, ya = yb, yb = t;
+  }
+  int16_t dx = xb - xa, dy = abs(yb - ya), err = dx / 2,
+          ystep = (ya < yb) ? 1 : -1;
+
+  // Physical steps for +1 along the line's long axis and for ystep
+  int8_t ax = !steep, ay = steep, bx = steep ? ystep : 0,
+         by = steep ? 0 : ystep;
+  unrotateStep(rotation, ax, ay);
+  unrotateStep(rotation, bx, by);
+
+  uint32_t c = color32(color);
+  DSCursor cur(type, matrixWidth, matrixHeight, tilesX, tilesY);
+  bool valid = false; // cur is at the current point
+  for (; xa <= xb; xa++) {
+    int16_t x = (steep ? ya : xa) - viewX, y = (steep ? xa : ya) - viewY;
+    bool in = (x >= left) && (y >= top) && (x < right) && (y < bottom);
+    if (in) {
+      if (!valid) {
+        unrotate(x, y);
+        cursorMoveTo(cur, x, y);
       }
+      setPixelColor(cur.index, c);
+    }
+    bool yStep = (err -= dy) < 0;
+    if (yStep) {
+      ya += ystep;
+      err += dx;
+    }
+    // Follow along to the next point if it's visible too (both corners
+    // of a diagonal step are then on the matrix, so either order works)
+    x = (steep ? ya : xa + 1) - viewX;
+    y = (steep ? xa + 1 : ya) - viewY;
+    valid = in && (x >= left) && (y >= top) && (x < right) && (y < bottom);
+    if (valid) {
+      cursorStep(cur, ax, ay);
+      if (yStep)
+        cursorStep(cur, bx, by);
+    }
+  }
+}
+
+bool Adafruit_DotStarMatrix::beginDisplayList(uint16_t maxCommands) {
+  endDisplayList();
+  if (!maxCommands ||
+      !(dlist = (DSCommand *)malloc(maxCommands * sizeof(DSCommand))))
+    return false;
+  dlistSize = maxCommands;
+  return true;
+}
+
+void Adafruit_DotStarMatrix::endDisplayList(void) {
+  flushDisplayList();
+  free(dlist);
+  dlist = NULL;
+  dlistSize = 0;
+}
+
+void Adafruit_DotStarMatrix::show(void) {
+  flushDisplayList();
+  if (strip) { // View: whole strip goes out from the owner
+    strip->show();
+    return;
+  }
+
+  uint8_t b = getBrightness(), out = b;
+  if (powerLimit) {
+    // Highest brightness (1-256 scale, as applied during output) that
+    // keeps the estimate within budget. Bypassed if already below it.
+    uint32_t full = ((powerSum + 127) / 255) * channelMilliamps;
+    if (full > powerLimit) {
+      uint32_t limit = ((uint32_t)powerLimit << 8) / full;
+      if (limit <= b) // i.e. less than b + 1
+        out = limit ? (limit - 1) : 0;
+    }
+  }
 
-      // Index of first pixel in tile
-      tileOffset = tile * matrixWidth * matrixHeight;
+  if (calibCopy) // Tile calibration and/or correction map in use
+    calibrate();
+  if (out != b)
+    setBrightness(out);
+  Adafruit_DotStar::show();
+  if (out != b)
+    setBrightness(b);
+  if (calibCopy)
+    memcpy(getPixels(), calibCopy, numPixels() * 3);
+}
+
+void Adafruit_DotStarMatrix::setPowerLimit(uint16_t milliamps,
+                                           uint8_t perChannel) {
+  powerLimit = milliamps;
+  channelMilliamps = perChannel;
+  powerSum = 0;
+  if (milliamps) { // Total up the existing buffer once
+    uint16_t n = numPixels();
+    for (uint16_t i = 0; i < n; i++)
+      powerSum += channelSum(getPixelColor(i));
+  }
+}
+
+uint32_t Adafruit_DotStarMatrix::getPowerEstimate(void) const {
+  uint32_t full = ((powerSum + 127) / 255) * channelMilliamps;
+  uint16_t b = (uint16_t)getBrightness() + 1;
+  return ((full >> 8) * b) + (((full & 0xFF) * b) >> 8); // No overflow
+}
+
+// Every write to the pixel buffer goes through here (GFX drawing, display
+// list, scroll, palette rows) so the power estimate can be maintained
+// incrementally: the old color's channels are swapped for the new one's.
+void Adafruit_DotStarMatrix::setPixelColor(uint16_t n, uint32_t c) {
+  if (strip) { // View: write within own range of the owner's strip
+    if (n < stripLength)
+      strip->setPixelColor(n + stripOffset, c);
+    return;
+  }
+  if (powerLimit && (n < numPixels()))
+    powerSum += channelSum(c) - channelSum(getPixelColor(n));
+  Adafruit_DotStar::setPixelColor(n, c);
+}
 
-    } // else no tiling (handle as single tile)
+void Adafruit_DotStarMatrix::setPixelColor(uint16_t n, uint8_t r, uint8_t g,
+                                           uint8_t b) {
+  setPixelColor(n, ((uint32_t)r << 16) | ((uint32_t)g << 8) | b);
+}
 
-    // Find pixel number within tile
-    minor = x; // Presume row major to start (will swap later if needed)
-    major = y;
+uint16_t Adafruit_DotStarMatrix::numTiles(void) const {
+  return tilesX ? (tilesX * tilesY) : 1;
+}
 
-    // Determine corner of entry, flip axes if needed
-    if (corner & DS_MATRIX_RIGHT)
-      minor = matrixWidth - 1 - minor;
-    if (corner & DS_MATRIX_BOTTOM)
-      major = matrixHeight - 1 - major;
+bool Adafruit_DotStarMatrix::setTileCalibration(uint16_t tile,
+                                                const int16_t m[9],
+                                                uint8_t level) {
+  uint16_t n = numTiles();
+  if (tile >= n)
+    return false;
+  if (!calib) {
+    calib = (int16_t *)malloc(n * 9 * sizeof(int16_t));
+    if (!calibCopy)
+      calibCopy = (uint8_t *)malloc(numPixels() * 3);
+    if (!calib || !calibCopy) {
+      clearCalibration();
+      return false;
+    }
+    for (uint16_t t = 0; t < n; t++) { // Identity for all tiles
+      int16_t *c = &calib[t * 9];
+      for (uint8_t i = 0; i < 9; i++)
+        c[i] = (i & 3) ? 0 : 256; // Diagonal is elements 0, 4, 8
+    }
+  }
+  // Fold level into the matrix so output is one multiply per term
+  int16_t *c = &calib[tile * 9];
+  for (uint8_t i = 0; i < 9; i++)
+    c[i] = ((int32_t)m[i] * (level + 1)) >> 8;
+  return true;
+}
+
+bool Adafruit_DotStarMatrix::setTileCalibration(uint16_t tile, uint8_t r,
+                                                uint8_t g, uint8_t b,
+                                                uint8_t level) {
+  int16_t m[9] = {0};
+  m[0] = r + 1;
+  m[4] = g + 1;
+  m[8] = b + 1;
+  return setTileCalibration(tile, m, level);
+}
+
+void Adafruit_DotStarMatrix::clearCalibration(void) {
+  free(calib);
+  calib = NULL;
+  if (!corrMap) {
+    free(calibCopy);
+    calibCopy = NULL;
+  }
+}
+
+// Allocate correction map (and copy buffer, if needed). NULL on failure.
+uint8_t *Adafruit_DotStarMatrix::allocCorrectionMap(void) {
+  if (!corrMap)
+    corrMap = (uint8_t *)malloc(numPixels() * 3);
+  if (!calibCopy)
+    calibCopy = (uint8_t *)malloc(numPixels() * 3);
+  if (!corrMap || !calibCopy) {
+    clearCorrectionMap();
+    return NULL;
+  }
+  return corrMap;
+}
+
+// Maps are stored in the pixel buffer's own byte order (rather than the
+// R, G, B order they're given in) so applying them is a flat loop.
+bool Adafruit_DotStarMatrix::setCorrectionMap(const uint8_t *gains) {
+  uint8_t *m = allocCorrectionMap();
+  if (!m)
+    return false;
+  for (uint16_t i = numPixels(); i--; gains += 3, m += 3) {
+    m[rByte] = gains[0];
+    m[gByte] = gains[1];
+    m[bByte] = gains[2];
+  }
+  return true;
+}
 
-    // Determine actual major axis of matrix
-    if ((type & DS_MATRIX_AXIS) == DS_MATRIX_ROWS) {
-      majorScale = matrixWidth;
+bool Adafruit_DotStarMatrix::loadCorrectionMap(Stream &s) {
+  uint8_t *m = allocCorrectionMap(), rgb[3];
+  if (!m)
+    return false;
+  for (uint16_t i = numPixels(); i--; m += 3) {
+    if (s.readBytes(rgb, 3) != 3) {
+      clearCorrectionMap();
+      return false;
+    }
+    m[rByte] = rgb[0];
+    m[gByte] = rgb[1];
+    m[bByte] = rgb[2];
+  }
+  return true;
+}
+
+void Adafruit_DotStarMatrix::clearCorrectionMap(void) {
+  free(corrMap);
+  corrMap = NULL;
+  if (!calib) {
+    free(calibCopy);
+    calibCopy = NULL;
+  }
+}
+
+// The strip grew from 'old' pixels (a view was attached past its end):
+// resize the per-LED buffers to match, the new LEDs uncorrected. Drops
+// calibration and correction map if there's not enough memory.
+void Adafruit_DotStarMatrix::growCalibration(uint16_t old) {
+  if (!calibCopy)
+    return;
+  uint32_t bytes = (uint32_t)numPixels() * 3;
+  free(calibCopy); // Contents are only needed during show()
+  calibCopy = bytes ? (uint8_t *)malloc(bytes) : NULL;
+  if (corrMap) {
+    uint8_t *m = (uint8_t *)realloc(corrMap, bytes);
+    if (m) {
+      memset(m + old * 3, 255, bytes - old * 3); // Gain of 1
+      corrMap = m;
     } else {
-      _swap_uint16_t(major, minor);
-      majorScale = matrixHeight;
+      clearCorrectionMap();
+    }
+  }
+  if (!calibCopy) {
+    clearCalibration();
+    clearCorrectionMap();
+  }
+}
+
+static inline uint8_t clamp8(int32_t v) {
+  return (v < 0) ? 0 : (v > 255) ? 255 : v;
+}
+
+// Save the pixel buffer, then apply each tile's color matrix and the
+// per-LED correction map in place, in strip order. Tiles with only
+// per-channel gains skip the cross terms.
+void Adafruit_DotStarMatrix::calibrate(void) {
+  uint8_t *p = getPixels();
+  uint32_t bytes = (uint32_t)numPixels() * 3;
+  memcpy(calibCopy, p, bytes);
+
+  if (calib) {
+    uint16_t tiles = numTiles();
+    // Own layout only; numPixels() may include LEDs of attached views
+    uint16_t tilePixels =
+        tilesX ? (matrixWidth * matrixHeight) : (WIDTH * HEIGHT);
+    for (uint16_t t = 0; t < tiles; t++) {
+      const int16_t *m = &calib[t * 9];
+      bool diagonal = !(m[1] | m[2] | m[3] | m[5] | m[6] | m[7]);
+      for (uint16_t i = 0; i < tilePixels; i++, p += 3) {
+        int32_t r = p[rByte], g = p[gByte], b = p[bByte];
+        if (diagonal) {
+          p[rByte] = clamp8((r * m[0]) >> 8);
+          p[gByte] = clamp8((g * m[4]) >> 8);
+          p[bByte] = clamp8((b * m[8]) >> 8);
+        } else {
+          p[rByte] = clamp8((r * m[0] + g * m[1] + b * m[2]) >> 8);
+          p[gByte] = clamp8((r * m[3] + g * m[4] + b * m[5]) >> 8);
+          p[bByte] = clamp8((r * m[6] + g * m[7] + b * m[8]) >> 8);
+        }
+      }
     }
+    p = getPixels();
+  }
 
-    // Determine pixel number within tile/matrix
-    if ((type & DS_MATRIX_SEQUENCE) == DS_MATRIX_PROGRESSIVE) {
-      // All lines in same order
-      pixelOffset = major * majorScale + minor;
+  if (corrMap) { // Same byte order as buffer, so no per-pixel unpacking
+    const uint8_t *m = corrMap;
+    for (uint32_t i = 0; i < bytes; i++)
+      p[i] = (p[i] * (m[i] + 1)) >> 8;
+  }
+}
+
+uint32_t Adafruit_DotStarMatrix::getPixelColor(uint16_t n) const {
+  if (strip)
+    return (n < stripLength) ? strip->getPixelColor(n + stripOffset) : 0;
+  return Adafruit_DotStar::getPixelColor(n);
+}
+
+uint32_t Adafruit_DotStarMatrix::getPixel(int16_t x, int16_t y) {
+  flushDisplayList(); // Pending fills may cover this pixel
+  x -= viewX;
+  y -= viewY;
+  if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+    return 0;
+  // Scaled pixels are blocks, any physical pixel within one will do
+  return getPixelColor(remapRotated(x * scaleX, y * scaleY));
+}
+
+uint16_t Adafruit_DotStarMatrix::getPixel565(int16_t x, int16_t y) {
+  uint32_t c = getPixel(x, y);
+  return ((uint16_t)pgm_read_byte(&igamma5[(c >> 16) & 0xFF]) << 11) |
+         ((uint16_t)pgm_read_byte(&igamma6[(c >> 8) & 0xFF]) << 5) |
+         pgm_read_byte(&igamma5[c & 0xFF]);
+}
+
+bool Adafruit_DotStarMatrix::blur(void) { return blurLines(0); }
+
+bool Adafruit_DotStarMatrix::boxBlur(uint8_t radius) {
+  return radius ? blurLines(radius > 127 ? 127 : radius) : true;
+}
+
+// Separable blur: filter every row of the unrotated pixel grid, then every
+// column. Each line is read into a buffer, then walked again writing back
+// the filtered values. Red and blue are summed together, in 16-bit lanes
+// of one 32-bit word, so each pixel is two adds rather than three. Radius
+// 0 is the 1-2-1 kernel, otherwise a box of 2 * radius + 1 pixels (sums
+// then stay under 65536, and are divided by a 16.16 reciprocal).
+bool Adafruit_DotStarMatrix::blurLines(uint8_t radius) {
+  flushDisplayList(); // Blur whatever's queued too
+  uint32_t *line = (uint32_t *)malloc(((WIDTH > HEIGHT) ? WIDTH : HEIGHT) *
+                                      sizeof(uint32_t));
+  if (!line)
+    return false;
+
+  for (uint8_t pass = 0; pass < 2; pass++) { // Rows, then columns
+    int16_t len = pass ? HEIGHT : WIDTH, count = pass ? WIDTH : HEIGHT;
+    int16_t r = (radius < len) ? radius : len - 1, n = 2 * r + 1;
+    uint32_t recip = (65536 + n / 2) / n;
+    for (int16_t k = 0; k < count; k++) {
+      DSCursor cur(type, matrixWidth, matrixHeight, tilesX, tilesY);
+      for (int16_t i = 0; i < len; i++) {
+        int16_t x = pass ? k : i, y = pass ? i : k;
+        line[i] = getPixelColor(remapFn ? remap(x, y) : cursorTo(cur, x, y));
+      }
+
+      // Box window sums for pixel 0, edge pixel counted for the overhang
+      uint32_t rb = 0, g = 0;
+      for (int16_t i = -r; i <= r; i++) {
+        rb += line[(i > 0) ? i : 0] & 0xFF00FF;
+        g += line[(i > 0) ? i : 0] & 0xFF00;
+      }
+      for (int16_t i = 0; i < len; i++) {
+        uint32_t c;
+        if (r) {
+          c = ((((rb >> 16) * recip + 0x8000) >> 16) << 16) |
+              ((((g >> 8) * recip + 0x8000) >> 16) << 8) |
+              (((rb & 0xFFFF) * recip + 0x8000) >> 16);
+          // Slide the window along: next pixel in, oldest out
+          uint32_t in = line[(i + r + 1 < len) ? i + r + 1 : len - 1],
+                   out = line[(i >= r) ? i - r : 0];
+          rb += (in & 0xFF00FF) - (out & 0xFF00FF);
+          g += (in & 0xFF00) - (out & 0xFF00);
+        } else {
+          uint32_t a = line[i ? i - 1 : 0], b = line[i],
+                   d = line[(i + 1 < len) ? i + 1 : len - 1];
+          c = ((((a & 0xFF00FF) + 2 * (b & 0xFF00FF) + (d & 0xFF00FF) +
+                 0x20002) >>
+                2) &
+               0xFF00FF) |
+              ((((a & 0xFF00) + 2 * (b & 0xFF00) + (d & 0xFF00) + 0x200) >>
+                2) &
+               0xFF00);
+        }
+        int16_t x = pass ? k : i, y = pass ? i : k;
+        setPixelColor(remapFn ? remap(x, y) : cursorTo(cur, x, y), c);
+      }
+    }
+  }
+  free(line);
+  return true;
+}
+
+// Clip a convolution sum (20.12 fixed point) to a color channel
+static inline uint32_t convolveChannel(int32_t sum, int16_t bias) {
+  sum = ((sum + 2048) >> 12) + bias;
+  return (sum < 0) ? 0 : (sum > 255) ? 255 : sum;
+}
+
+// Work down the unrotated grid a row at a time. The line buffer holds the
+// original (unfiltered) row above; as each pixel is written, the original
+// one to its left takes its slot, which is then finished with. The row
+// below hasn't been touched yet, so is read straight from the strip.
+bool Adafruit_DotStarMatrix::convolve(const int8_t *kernel, int16_t divisor,
+                                      int16_t bias) {
+  flushDisplayList();
+  if (!divisor)
+    divisor = 1;
+  uint32_t *line = (uint32_t *)malloc(WIDTH * sizeof(uint32_t));
+  if (!line)
+    return false;
+
+  // Rotate the kernel to match the unrotated grid, as 20.12 fixed-point
+  // weights with the divisor folded in, so there's no divide per pixel
+  int32_t k[9];
+  for (int8_t j = 0; j < 3; j++) {
+    for (int8_t i = 0; i < 3; i++) {
+      int8_t dx = i - 1, dy = j - 1;
+      unrotateStep(rotation, dx, dy);
+      k[(dy + 1) * 3 + dx + 1] = (int32_t)kernel[j * 3 + i] * 4096 / divisor;
+    }
+  }
+
+  DSCursor above(type, matrixWidth, matrixHeight, tilesX, tilesY);
+  for (int16_t x = 0; x < WIDTH; x++)
+    line[x] = getPixelColor(remapFn ? remap(x, 0) : cursorTo(above, x, 0));
+
+  for (int16_t y = 0; y < HEIGHT; y++) {
+    DSCursor here(type, matrixWidth, matrixHeight, tilesX, tilesY),
+        ahead = here, below = here;
+    bool last = (y + 1) >= HEIGHT;
+    uint32_t win[3][3]; // Original pixels around x: row above, this, below
+    for (int16_t x = -1; x < WIDTH; x++) {
+      // Shift the window left and read the column at x + 1
+      int16_t nx = (x + 1 < WIDTH) ? x + 1 : WIDTH - 1;
+      for (uint8_t j = 0; j < 3; j++) {
+        win[j][0] = win[j][1];
+        win[j][1] = win[j][2];
+      }
+      win[0][2] = line[nx];
+      if (nx == x + 1) {
+        win[1][2] = getPixelColor(remapFn ? remap(nx, y)
+                                          : cursorTo(ahead, nx, y));
+        win[2][2] = last ? win[1][2]
+                         : getPixelColor(remapFn ? remap(nx, y + 1)
+                                                 : cursorTo(below, nx, y + 1));
+      } else { // Past the right edge, repeat the edge pixel
+        win[1][2] = win[1][1];
+        win[2][2] = win[2][1];
+      }
+      if (x < 0) { // Left edge pixel extends outward too
+        for (uint8_t j = 0; j < 3; j++)
+          win[j][1] = win[j][2];
+        continue;
+      }
+
+      int32_t r = 0, g = 0, b = 0;
+      for (uint8_t j = 0; j < 3; j++) {
+        for (uint8_t i = 0; i < 3; i++) {
+          int32_t w = k[j * 3 + i];
+          uint32_t c = win[j][i];
+          r += w * (uint8_t)(c >> 16);
+          g += w * (uint8_t)(c >> 8);
+          b += w * (uint8_t)c;
+        }
+      }
+      setPixelColor(remapFn ? remap(x, y) : cursorTo(here, x, y),
+                    (convolveChannel(r, bias) << 16) |
+                        (convolveChannel(g, bias) << 8) |
+                        convolveChannel(b, bias));
+      if (x) // Original pixel to the left is the row above for the next row
+        line[x - 1] = win[1][0];
+    }
+    line[WIDTH - 1] = win[1][1];
+  }
+  free(line);
+  return true;
+}
+
+void Adafruit_DotStarMatrix::clear(void) {
+  dlistCount = 0;
+  if (strip) { // View: only its own range
+    for (uint16_t i = 0; i < stripLength; i++)
+      setPixelColor(i, 0);
+    return;
+  }
+  powerSum = 0;
+  Adafruit_DotStar::clear();
+}
+
+void Adafruit_DotStarMatrix::fill(uint32_t c, uint16_t first,
+                                  uint16_t count) {
+  uint16_t n = strip ? stripLength : numPixels();
+  if (first >= n)
+    return;
+  if (!count || (count > (n - first)))
+    count = n - first;
+  while (count--)
+    setPixelColor(first++, c);
+}
+
+// Fill a rect (virtual canvas coordinates) as a whole if a display list
+// or scaling is active. Returns false if neither is, in which case the
+// caller draws as usual (i.e. a single pixel's faster path).
+bool Adafruit_DotStarMatrix::fillBlock(int16_t x, int16_t y, int16_t w,
+                                       int16_t h, uint16_t color) {
+  if (!dlist && (scaleX == 1) && (scaleY == 1))
+    return false;
+  fillSpan(x, y, w, h, color32(color));
+  return true;
+}
+
+// Fill a rect (virtual canvas coordinates) in an already-expanded color:
+// clip, scale and rotate it once, then queue it on the display list or
+// fill it right away. All rect, line-run and filled-shape drawing ends
+// up here.
+void Adafruit_DotStarMatrix::fillSpan(int16_t x, int16_t y, int16_t w,
+                                      int16_t h, uint32_t c) {
+  if (!toScreen(x, y, w, h))
+    return;
+  x *= scaleX; // Logical pixels to blocks of physical pixels
+  y *= scaleY;
+  w *= scaleX;
+  h *= scaleY;
+
+  // Rotate rect to unrotated (physical) coordinates, so execution can
+  // work in tiles and never has to think about rotation.
+  unrotateRect(x, y, w, h);
+
+  if (!dlist) {
+    fillUnrotated(x, y, w, h, c);
+    return;
+  }
+
+  // Merge with previous command if same color and the two make a rect
+  // (e.g. runs of pixels in a row, or scaled text dots).
+  if (dlistCount) {
+    DSCommand *p = &dlist[dlistCount - 1];
+    if (p->color == c) {
+      if ((p->y == y) && (p->h == h)) {
+        if ((p->x + p->w) == x) {
+          p->w += w;
+          return;
+        }
+        if ((x + w) == p->x) {
+          p->x = x;
+          p->w += w;
+          return;
+        }
+      } else if ((p->x == x) && (p->w == w)) {
+        if ((p->y + p->h) == y) {
+          p->h += h;
+          return;
+        }
+        if ((y + h) == p->y) {
+          p->y = y;
+          p->h += h;
+          return;
+        }
+      }
+    }
+  }
+
+  if (dlistCount >= dlistSize)
+    flushDisplayList();
+  DSCommand *n = &dlist[dlistCount++];
+  n->x = x;
+  n->y = y;
+  n->w = w;
+  n->h = h;
+  n->color = c;
+}
+
+#define DS_OCCLUDERS 4 ///< Number of fills tracked for occlusion culling
+
+void Adafruit_DotStarMatrix::flushDisplayList(void) {
+  if (!dlistCount)
+    return;
+
+  // Cull commands that later fills cover completely. Walking back to
+  // front, keep the largest few fills seen so far as occluders; anything
+  // entirely inside one of them would be overwritten anyway.
+  DSCommand *occ[DS_OCCLUDERS];
+  uint8_t numOcc = 0;
+  for (uint16_t i = dlistCount; i--;) {
+    DSCommand *c = &dlist[i];
+    for (uint8_t k = 0; k < numOcc; k++) {
+      if ((c->x >= occ[k]->x) && (c->y >= occ[k]->y) &&
+          ((c->x + c->w) <= (occ[k]->x + occ[k]->w)) &&
+          ((c->y + c->h) <= (occ[k]->y + occ[k]->h))) {
+        c->w = 0;
+        break;
+      }
+    }
+    if (!c->w)
+      continue;
+    int32_t area = (int32_t)c->w * c->h;
+    if (numOcc < DS_OCCLUDERS) {
+      occ[numOcc++] = c;
     } else {
-      // Zigzag; alternate rows change direction.
-      if (major & 1)
-        pixelOffset = (major + 1) * majorScale - 1 - minor;
-      else
-        pixelOffset = major * majorScale + minor;
+      uint8_t smallest = 0;
+      for (uint8_t k = 1; k < DS_OCCLUDERS; k++) {
+        if (((int32_t)occ[k]->w * occ[k]->h) <
+            ((int32_t)occ[smallest]->w * occ[smallest]->h))
+          smallest = k;
+      }
+      if (area > ((int32_t)occ[smallest]->w * occ[smallest]->h))
+        occ[smallest] = c;
     }
   }
 
-  setPixelColor(tileOffset + pixelOffset,
-                passThruFlag ? passThruColor : expandColor(color));
+  // Execute one tile at a time, in order within each tile, so the
+  // writes for each stay within one contiguous stretch of the strip.
+  // (Symmetry writes outside the tile, so then keep strict order.)
+  int16_t tw = (tilesX && !symTable) ? matrixWidth : WIDTH;
+  int16_t th = (tilesX && !symTable) ? matrixHeight : HEIGHT;
+  for (int16_t ty = 0; ty < HEIGHT; ty += th) {
+    for (int16_t tx = 0; tx < WIDTH; tx += tw) {
+      for (uint16_t i = 0; i < dlistCount; i++) {
+        DSCommand *c = &dlist[i];
+        if (!c->w)
+          continue;
+        int16_t left = (c->x > tx) ? c->x : tx;
+        int16_t top = (c->y > ty) ? c->y : ty;
+        int16_t right = ((c->x + c->w) < (tx + tw)) ? (c->x + c->w) : (tx + tw);
+        int16_t bottom =
+            ((c->y + c->h) < (ty + th)) ? (c->y + c->h) : (ty + th);
+        if ((left < right) && (top < bottom))
+          fillUnrotated(left, top, right - left, bottom - top, c->color);
+      }
+    }
+  }
+
+  dlistCount = 0;
 }
 
-void Adafruit_DotStarMatrix::fillScreen(uint16_t color) {
-  uint16_t i, n;
-  uint32_t c;
+// Fill rect in unrotated coordinates (already clipped) with 24-bit color
+void Adafruit_DotStarMatrix::fillUnrotated(int16_t x, int16_t y, int16_t w,
+                                           int16_t h, uint32_t c) {
+  if (symTable || remapFn) { // Map every pixel
+    for (int16_t j = y; j < y + h; j++) {
+      for (int16_t i = x; i < x + w; i++)
+        writeXY(i, j, c);
+    }
+    return;
+  }
+  // Map one corner, then step along the longer side (rows, or columns if
+  // taller than wide), and from the start of one to the next
+  bool across = (w >= h);
+  int16_t len = across ? w : h, count = across ? h : w;
+  DSCursor start(type, matrixWidth, matrixHeight, tilesX, tilesY);
+  cursorMoveTo(start, x, y);
+  for (;;) {
+    DSCursor cur = start;
+    for (int16_t i = 1;; i++) {
+      setPixelColor(cur.index, c);
+      if (i >= len)
+        break;
+      cursorStep(cur, across, !across);
+    }
+    if (!--count)
+      break;
+    cursorStep(start, !across, across);
+  }
+}
 
-  c = passThruFlag ? passThruColor : expandColor(color);
-  n = numPixels();
-  for (i = 0; i < n; i++)
-    setPixelColor(i, c);
+// Convert a rect from virtual canvas to screen coordinates and clip it to
+// the screen (or the region being redrawn by panViewport()). Returns
+// false if nothing is left.
+bool Adafruit_DotStarMatrix::toScreen(int16_t &x, int16_t &y, int16_t &w,
+                                      int16_t &h) {
+  int16_t left = clipW ? clipX : 0, top = clipW ? clipY : 0;
+  int16_t right = clipW ? (clipX + clipW) : _width;
+  int16_t bottom = clipW ? (clipY + clipH) : _height;
+  x -= viewX;
+  y -= viewY;
+  if (x < left) {
+    w -= left - x;
+    x = left;
+  }
+  if (y < top) {
+    h -= top - y;
+    y = top;
+  }
+  if ((x + w) > right)
+    w = right - x;
+  if ((y + h) > bottom)
+    h = bottom - y;
+  return (w > 0) && (h > 0);
 }
 
-void Adafruit_DotStarMatrix::setRemapFunction(uint16_t (*fn)(uint16_t,
-                                                             uint16_t)) {
-  remapFn = fn;
+void Adafruit_DotStarMatrix::setViewport(int16_t x, int16_t y) {
+  flushDisplayList(); // Pending commands were clipped to the old view
+  viewX = x;
+  viewY = y;
+}
+
+void Adafruit_DotStarMatrix::panViewport(int16_t dx, int16_t dy,
+                                         void (*redraw)(void),
+                                         uint16_t color) {
+  flushDisplayList();
+  viewX += dx;
+  viewY += dy;
+  scroll(-dx, -dy, color); // Contents move opposite to the view
+  if (!redraw)
+    return;
+
+  // Redraw only what was scrolled in: a band of columns, then a band of
+  // rows (less the corner the columns already covered).
+  int16_t adx = (dx < 0) ? -dx : dx, ady = (dy < 0) ? -dy : dy;
+  if (adx > _width)
+    adx = _width;
+  if (ady > _height)
+    ady = _height;
+  if (adx) {
+    clipX = (dx > 0) ? (_width - adx) : 0;
+    clipY = 0;
+    clipW = adx;
+    clipH = _height;
+    redraw();
+  }
+  if (ady && (adx < _width)) {
+    clipX = (dx > 0) ? 0 : adx;
+    clipY = (dy > 0) ? (_height - ady) : 0;
+    clipW = _width - adx;
+    clipH = ady;
+    redraw();
+  }
+  clipW = 0;
+}
+
+void Adafruit_DotStarMatrix::scroll(int16_t dx, int16_t dy, uint16_t color) {
+  scrollRect(0, 0, _width, _height, dx, dy, color);
+}
+
+void Adafruit_DotStarMatrix::scrollRect(int16_t x, int16_t y, int16_t w,
+                                        int16_t h, int16_t dx, int16_t dy,
+                                        uint16_t color) {
+  if (x < 0) { // Clip to screen
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if ((x + w) > _width)
+    w = _width - x;
+  if ((y + h) > _height)
+    h = _height - y;
+  if ((w <= 0) || (h <= 0))
+    return;
+  x *= scaleX; // Logical pixels to blocks of physical pixels
+  y *= scaleY;
+  w *= scaleX;
+  h *= scaleY;
+  dx *= scaleX;
+  dy *= scaleY;
+
+  flushDisplayList(); // Scroll what's been drawn so far
+  uint32_t c = color32(color);
+
+  // Walk against the direction of motion so each source pixel is read
+  // before it's overwritten. Source and destination each have a cursor
+  // following along the strip, rather than remapping every pixel.
+  int16_t i0 = (dx > 0) ? (w - 1) : 0, di = (dx > 0) ? -1 : 1;
+  int16_t j0 = (dy > 0) ? (h - 1) : 0, dj = (dy > 0) ? -1 : 1;
+  DSCursor src(type, matrixWidth, matrixHeight, tilesX, tilesY), dst = src;
+  for (int16_t j = j0, nj = h; nj--; j += dj) {
+    int16_t sj = j - dy;
+    for (int16_t i = i0, ni = w; ni--; i += di) {
+      int16_t si = i - dx, px, py;
+      uint32_t p = c; // Vacated pixels are filled with color
+      if ((si >= 0) && (si < w) && (sj >= 0) && (sj < h)) {
+        px = x + si;
+        py = y + sj;
+        unrotate(px, py);
+        p = getPixelColor(remapFn ? remap(px, py) : cursorTo(src, px, py));
+      }
+      px = x + i;
+      py = y + j;
+      unrotate(px, py);
+      setPixelColor(remapFn ? remap(px, py) : cursorTo(dst, px, py), p);
+    }
+  }
 }
@@ -39,41 +39,26 @@
 #include <pins_arduino.h>
 #endif
 #include <Adafruit_DotStar.h>
+#include <Adafruit_DotStarMatrixLayout.h>
 #include <Adafruit_GFX.h>
 
-// Matrix layout information is passed in the 'matrixType' parameter for
-// each constructor (the parameter immediately following is the LED type
-// from Adafruit_DotStar.h).
-
-// These define the layout for a single 'unified' matrix (e.g. one made
-// from DotStar strips), or for the pixels within each matrix of a tiled
-// display.
-
-#define DS_MATRIX_TOP 0x00         ///< Pixel 0 is at top of matrix
-#define DS_MATRIX_BOTTOM 0x01      ///< Pixel 0 is at bottom of matrix
-#define DS_MATRIX_LEFT 0x00        ///< Pixel 0 is at left of matrix
-#define DS_MATRIX_RIGHT 0x02       ///< Pixel 0 is at right of matrix
-#define DS_MATRIX_CORNER 0x03      ///< Bitmask for pixel 0 matrix corner
-#define DS_MATRIX_ROWS 0x00        ///< Matrix is row major (horizontal)
-#define DS_MATRIX_COLUMNS 0x04     ///< Matrix is column major (vertical)
-#define DS_MATRIX_AXIS 0x04        ///< Bitmask for row/column layout
-#define DS_MATRIX_PROGRESSIVE 0x00 ///< Same pixel order across each line
-#define DS_MATRIX_ZIGZAG 0x08      ///< Pixel order reverses between lines
-#define DS_MATRIX_SEQUENCE 0x08    ///< Bitmask for pixel line order
-
-// These apply only to tiled displays (multiple matrices):
-
-#define DS_TILE_TOP 0x00         ///< First tile is at top of matrix
-#define DS_TILE_BOTTOM 0x10      ///< First tile is at bottom of matrix
-#define DS_TILE_LEFT 0x00        ///< First tile is at left of matrix
-#define DS_TILE_RIGHT 0x20       ///< First tile is at right of matrix
-#define DS_TILE_CORNER 0x30      ///< Bitmask for first tile corner
-#define DS_TILE_ROWS 0x00        ///< Tiles ordered in rows
-#define DS_TILE_COLUMNS 0x40     ///< Tiles ordered in columns
-#define DS_TILE_AXIS 0x40        ///< Bitmask for tile H/V orientation
-#define DS_TILE_PROGRESSIVE 0x00 ///< Same tile order across each line
-#define DS_TILE_ZIGZAG 0x80      ///< Tile order reverses between lines
-#define DS_TILE_SEQUENCE 0x80    ///< Bitmask for tile line order
+// Symmetry modes for setSymmetry(), relative to the screen (rotation
+// taken into account):
+
+#define DS_SYMMETRY_NONE 0x00 ///< Normal drawing
+#define DS_MIRROR_X 0x01      ///< Left and right halves mirror each other
+#define DS_MIRROR_Y 0x02      ///< Top and bottom halves mirror each other
+#define DS_MIRROR_XY 0x03     ///< 4-way: all four quadrants mirror
+#define DS_KALEIDOSCOPE 0x07  ///< 8-way: also mirror on diagonals (square)
+
+#define DS_ROTOZOOM_MIN (1.0 / 1024.0) ///< Smallest drawRotoZoom() zoom
+
+// Source pixel formats for updateRegion():
+
+#define DS_REGION_565 0     ///< uint16_t per pixel, '565' RGB (gamma applied)
+#define DS_REGION_888 1     ///< 3 bytes per pixel: R, G, B (issued as-is)
+#define DS_REGION_PALETTE 2 ///< 1 byte per pixel, index into 0RGB palette
+#define DS_REGION_RAW 3     ///< 3 bytes per pixel in strip's color order
 
 /**
  * @brief Class for using DotStar matrices with the GFX graphics library.
@@ -141,6 +126,83 @@ public:
                          uint8_t tY, uint8_t d, uint8_t c, uint8_t matrixType,
                          uint8_t ledType);
 
+  /**
+   * @brief  Construct a single (non-tiled) matrix that shares another
+   *         matrix's strip, e.g. a small status panel daisy-chained after
+   *         a main display on the same data line. It has its own layout,
+   *         rotation and GFX state, but no pixel buffer of its own: its
+   *         pixels occupy a range of the other matrix's strip (which is
+   *         enlarged to include it if needed), and show() on either
+   *         issues the whole chain in one transfer. Call begin() only on
+   *         the owning matrix, and set brightness, power limits and
+   *         calibration there too, before or after creating views. When
+   *         the strip is enlarged its pixel buffer is cleared, and the LEDs
+   *         added get a correction map gain of 1 (unchanged), so set a map
+   *         that covers a view's LEDs after that view is created.
+   * @param  strip       Matrix whose strip and pixel buffer to share.
+   * @param  first       Strip index of this matrix's first pixel.
+   * @param  w           Matrix width in pixels.
+   * @param  h           Matrix height in pixels.
+   * @param  matrixType  Matrix layout - add together DS_MATRIX_* values
+   *                     to declare orientation, rotation, etc.
+   */
+  Adafruit_DotStarMatrix(Adafruit_DotStarMatrix &strip, uint16_t first,
+                         int w, int h, uint8_t matrixType);
+
+  /**
+   * @brief  Construct a tiled matrix that shares another matrix's strip.
+   *         See above.
+   * @param  strip       Matrix whose strip and pixel buffer to share.
+   * @param  first       Strip index of this matrix's first pixel.
+   * @param  matrixW     Individual sub-matrix (tile) width in pixels.
+   * @param  matrixH     Individual sub-matrix (tile) height in pixels.
+   * @param  tX          Number of tiles on the X (horizontal) axis.
+   * @param  tY          Number of tiles on the Y (vertical) axis.
+   * @param  matrixType  Tiled matrix layout - add together DS_MATRIX_* and
+   *                     DS_TILE_* values to declare orientation, rotation,
+   *                     etc.
+   */
+  Adafruit_DotStarMatrix(Adafruit_DotStarMatrix &strip, uint16_t first,
+                         uint8_t matrixW, uint8_t matrixH, uint8_t tX,
+                         uint8_t tY, uint8_t matrixType);
+
+  ~Adafruit_DotStarMatrix(void);
+
+  /**
+   * @brief   Change to a different single (non-tiled) matrix layout in
+   *          place, e.g. to reuse a controller for another panel. The
+   *          pixel buffer isn't reallocated, so the new layout must fit
+   *          in the LED count given to the constructor (LEDs added to
+   *          the strip for views sharing it are left alone); any LEDs
+   *          past the end of the new layout are cleared. Drawing contents
+   *          are otherwise left as-is (in strip order), and rotation is
+   *          kept.
+   * @param   w           New matrix width in pixels.
+   * @param   h           New matrix height in pixels.
+   * @param   matrixType  Matrix layout - add together DS_MATRIX_* values
+   *                      to declare orientation, rotation, etc.
+   * @return  true on success, false if the layout needs more LEDs than
+   *          the buffer holds (nothing is changed).
+   */
+  bool setLayout(int w, int h, uint8_t matrixType);
+
+  /**
+   * @brief   Change to a different tiled matrix layout in place. As
+   *          above; also, per-tile calibration is discarded if the number
+   *          of tiles changes.
+   * @param   matrixW     Individual sub-matrix (tile) width in pixels.
+   * @param   matrixH     Individual sub-matrix (tile) height in pixels.
+   * @param   tX          Number of tiles on the X (horizontal) axis.
+   * @param   tY          Number of tiles on the Y (vertical) axis.
+   * @param   matrixType  Tiled matrix layout - add together DS_MATRIX_*
+   *                      and DS_TILE_* values to declare orientation,
+   *                      rotation, etc.
+   * @return  true on success, false if the layout needs more LEDs than
+   *          the buffer holds (nothing is changed).
+   */
+  bool setLayout(uint8_t matrixW, uint8_t matrixH, uint8_t tX, uint8_t tY,
+                 uint8_t matrixType);
+
   /**
    * @brief  Pixel-drawing function for Adafruit_GFX.
    * @param  x      Pixel column (0 = left edge, unless rotation used).
@@ -149,12 +211,504 @@ public:
    */
   void drawPixel(int16_t x, int16_t y, uint16_t color);
 
+  /**
+   * @brief  Draw one character, as in Adafruit_GFX, in virtual canvas
+   *         coordinates if a viewport is set.
+   * @param  x      Left edge.
+   * @param  y      Top edge (built-in font) or baseline (GFX fonts).
+   * @param  c      Character.
+   * @param  color  16-bit '565' text color.
+   * @param  bg     16-bit '565' background color, same as color for a
+   *                transparent background (built-in font only).
+   * @param  size   Magnification.
+   */
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                uint16_t bg, uint8_t size);
+
+  /**
+   * @brief  Draw one character with separate X and Y magnification. As
+   *         above.
+   * @param  x       Left edge.
+   * @param  y       Top edge (built-in font) or baseline (GFX fonts).
+   * @param  c       Character.
+   * @param  color   16-bit '565' text color.
+   * @param  bg      16-bit '565' background color, same as color for a
+   *                 transparent background (built-in font only).
+   * @param  size_x  Horizontal magnification.
+   * @param  size_y  Vertical magnification.
+   */
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                uint16_t bg, uint8_t size_x, uint8_t size_y);
+
+  /**
+   * @brief   Print one character at the cursor (Adafruit_GFX override, so
+   *          print() works in virtual canvas coordinates if a viewport is
+   *          set).
+   * @param   c  Character.
+   * @return  size_t  1.
+   */
+  size_t write(uint8_t c);
+  using Print::write;
+
+  /**
+   * @brief  Set rotation (Adafruit_GFX override, so symmetry modes can
+   *         follow the screen axes).
+   * @param  r  Rotation, 0-3 (multiples of 90 degrees clockwise).
+   */
+  void setRotation(uint8_t r);
+
+  /**
+   * @brief  Draw at a lower resolution than the matrix, with each logical
+   *         pixel filling a block of physical pixels, e.g. so text and
+   *         graphics on a large, coarse wall cost no more than on a
+   *         small matrix. width() and height() become the logical size
+   *         (any leftover physical rows or columns are unused). Each
+   *         pixel, line or rect is filled as one block rather than pixel
+   *         by pixel. The viewport, scroll() and scrollRect() work in
+   *         logical pixels too.
+   * @param  sx  Horizontal scale factor (1 = normal).
+   * @param  sy  Vertical scale factor (1 = normal).
+   */
+  void setScale(uint8_t sx, uint8_t sy);
+
+  /**
+   * @brief   Mirror all drawing into symmetric copies, e.g. for
+   *          kaleidoscope effects: each pixel drawn anywhere is also
+   *          written to its mirror images, so a shape is drawn once
+   *          rather than 2-8 times. The mirror images' strip indices are
+   *          precomputed in a table (rebuilt on rotation or layout
+   *          changes), so each extra copy costs just one store. Whatever
+   *          is drawn last wins, on either side of a mirror axis.
+   *          Doesn't affect scroll(), or setPixelColor() by strip index.
+   * @param   mode  DS_SYMMETRY_NONE, DS_MIRROR_X, DS_MIRROR_Y, DS_MIRROR_XY
+   *                or DS_KALEIDOSCOPE (8-way needs a square matrix, else
+   *                it's 4-way).
+   * @return  true on success, false if the table couldn't be allocated
+   *          (drawing is then normal).
+   */
+  bool setSymmetry(uint8_t mode);
+
   /**
    * @brief  Fill matrix with a single color.
    * @param  color  Pixel color in 16-bit '565' RGB format.
    */
   void fillScreen(uint16_t color);
 
+  /**
+   * @brief  Fill a rectangle (Adafruit_GFX override, so rects can be
+   *         queued whole when a display list is active).
+   * @param  x      Left edge.
+   * @param  y      Top edge.
+   * @param  w      Width in pixels.
+   * @param  h      Height in pixels.
+   * @param  color  Fill color in 16-bit '565' RGB format.
+   */
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+  /**
+   * @brief  Fill a rectangle within a startWrite()/endWrite() pair.
+   * @param  x      Left edge.
+   * @param  y      Top edge.
+   * @param  w      Width in pixels.
+   * @param  h      Height in pixels.
+   * @param  color  Fill color in 16-bit '565' RGB format.
+   */
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                     uint16_t color);
+
+  /**
+   * @brief  Draw a horizontal line.
+   * @param  x      Left edge.
+   * @param  y      Row.
+   * @param  w      Length in pixels.
+   * @param  color  Line color in 16-bit '565' RGB format.
+   */
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+
+  /**
+   * @brief  Draw a vertical line.
+   * @param  x      Column.
+   * @param  y      Top edge.
+   * @param  h      Length in pixels.
+   * @param  color  Line color in 16-bit '565' RGB format.
+   */
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+
+  /**
+   * @brief  Draw a horizontal line within a startWrite()/endWrite() pair.
+   * @param  x      Left edge.
+   * @param  y      Row.
+   * @param  w      Length in pixels.
+   * @param  color  Line color in 16-bit '565' RGB format.
+   */
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+
+  /**
+   * @brief  Draw a vertical line within a startWrite()/endWrite() pair.
+   * @param  x      Column.
+   * @param  y      Top edge.
+   * @param  h      Length in pixels.
+   * @param  color  Line color in 16-bit '565' RGB format.
+   */
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+
+  /**
+   * @brief  Draw a line within a startWrite()/endWrite() pair (also used
+   *         by drawLine() for diagonal lines). Same pixels as
+   *         Adafruit_GFX, but the strip index is stepped along the line
+   *         rather than recomputed for every pixel.
+   * @param  xa     Column of first point.
+   * @param  ya     Row of first point.
+   * @param  xb     Column of second point.
+   * @param  yb     Row of second point.
+   * @param  color  Line color in 16-bit '565' RGB format.
+   */
+  void writeLine(int16_t xa, int16_t ya, int16_t xb, int16_t yb,
+                 uint16_t color);
+
+  /**
+   * @brief  Draw a filled circle. Replaces the Adafruit_GFX version (same
+   *         pixels) so that each span is filled as a block rather than
+   *         pixel by pixel.
+   * @param  cx     Center column.
+   * @param  cy     Center row.
+   * @param  r      Radius.
+   * @param  color  Fill color in 16-bit '565' RGB format.
+   */
+  void fillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color);
+
+  /**
+   * @brief  Draw a filled triangle, filled span by span as for
+   *         fillCircle().
+   * @param  xa     Column of first corner.
+   * @param  ya     Row of first corner.
+   * @param  xb     Column of second corner.
+   * @param  yb     Row of second corner.
+   * @param  xc     Column of third corner.
+   * @param  yc     Row of third corner.
+   * @param  color  Fill color in 16-bit '565' RGB format.
+   */
+  void fillTriangle(int16_t xa, int16_t ya, int16_t xb, int16_t yb,
+                    int16_t xc, int16_t yc, uint16_t color);
+
+  /**
+   * @brief  Draw a filled rectangle with rounded corners, filled span by
+   *         span as for fillCircle().
+   * @param  x      Left edge.
+   * @param  y      Top edge.
+   * @param  w      Width in pixels.
+   * @param  h      Height in pixels.
+   * @param  r      Corner radius.
+   * @param  color  Fill color in 16-bit '565' RGB format.
+   */
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r,
+                     uint16_t color);
+
+  /**
+   * @brief  Shift the whole display contents within the pixel buffer,
+   *         without redrawing.
+   * @param  dx     Pixels to move right (negative = left).
+   * @param  dy     Pixels to move down (negative = up).
+   * @param  color  Color for vacated pixels, 16-bit '565' RGB format.
+   */
+  void scroll(int16_t dx, int16_t dy, uint16_t color = 0);
+
+  /**
+   * @brief  Shift the contents of a rectangle within the pixel buffer,
+   *         without redrawing. Pixels moved outside the rectangle are
+   *         discarded; pixels outside it are untouched.
+   * @param  x      Left edge of rectangle.
+   * @param  y      Top edge of rectangle.
+   * @param  w      Width of rectangle in pixels.
+   * @param  h      Height of rectangle in pixels.
+   * @param  dx     Pixels to move right (negative = left).
+   * @param  dy     Pixels to move down (negative = up).
+   * @param  color  Color for vacated pixels, 16-bit '565' RGB format.
+   */
+  void scrollRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dx,
+                  int16_t dy, uint16_t color = 0);
+
+  /**
+   * @brief  Treat the screen as a window onto a larger virtual canvas:
+   *         all drawing coordinates are offset so that virtual (x, y)
+   *         appears at the top-left corner, and anything outside the
+   *         window is clipped before it reaches the pixel buffer. Does
+   *         not change the buffer; redraw afterward. Every drawing call
+   *         (pixels, lines, shapes, bitmaps, drawChar(), print() and
+   *         setCursor()) works in virtual canvas coordinates, so e.g. a
+   *         long message can be printed once and scrolled past. scroll(),
+   *         scrollRect(), width() and height() are in screen coordinates
+   *         regardless. Text wrap still happens at the right edge of the
+   *         screen, so turn it off with setTextWrap(false) for text wider
+   *         than the screen.
+   * @param  x  Virtual canvas column at left edge of screen.
+   * @param  y  Virtual canvas row at top edge of screen.
+   */
+  void setViewport(int16_t x, int16_t y);
+
+  /**
+   * @brief  Move the viewport by an offset. The pixel buffer is scrolled
+   *         to match, then only the newly exposed area needs drawing: if
+   *         given, the redraw function is called with drawing clipped to
+   *         that area (once for exposed columns and once for exposed rows
+   *         when moving diagonally), so it can simply draw the whole
+   *         scene again and fillScreen() fills just the exposed area.
+   * @param  dx      Columns to move the view right (negative = left).
+   * @param  dy      Rows to move the view down (negative = up).
+   * @param  redraw  Function that draws the scene in virtual coordinates,
+   *                 or NULL to leave the exposed area filled with color.
+   * @param  color   Fill color for exposed area, 16-bit '565' RGB format.
+   */
+  void panViewport(int16_t dx, int16_t dy, void (*redraw)(void) = NULL,
+                   uint16_t color = 0);
+
+  /**
+   * @brief   Get virtual canvas column at left edge of screen.
+   * @return  int16_t  Viewport X offset.
+   */
+  int16_t getViewportX(void) const { return viewX; }
+
+  /**
+   * @brief   Get virtual canvas row at top edge of screen.
+   * @return  int16_t  Viewport Y offset.
+   */
+  int16_t getViewportY(void) const { return viewY; }
+
+  /**
+   * @brief   Start recording drawing into a display list instead of the
+   *          pixel buffer. GFX drawing calls are queued as compact fill
+   *          commands (adjacent same-color fills are merged as they
+   *          arrive) and executed at show() or flushDisplayList(): fills
+   *          entirely hidden by later fills are skipped, and the rest are
+   *          executed one tile at a time. Pays off for scenes with lots of
+   *          overdraw, e.g. fillScreen() followed by layered shapes. Direct
+   *          setPixelColor() calls bypass the list; flush first if mixing.
+   * @param   maxCommands  List capacity (12 bytes each). If it fills up,
+   *                       the list is flushed and recording continues.
+   * @return  true on success, false if the list couldn't be allocated.
+   */
+  bool beginDisplayList(uint16_t maxCommands);
+
+  /**
+   * @brief  Execute any pending display list commands, stop recording and
+   *         release the list. Drawing goes straight to the pixel buffer
+   *         again.
+   */
+  void endDisplayList(void);
+
+  /**
+   * @brief  Execute and clear any pending display list commands without
+   *         issuing data to the LEDs.
+   */
+  void flushDisplayList(void);
+
+  /**
+   * @brief  Execute any pending display list commands, then issue the
+   *         pixel buffer to the LEDs (same as Adafruit_DotStar::show()).
+   */
+  void show(void);
+
+  /**
+   * @brief  Limit estimated supply current. A running total of all color
+   *         channels is kept up to date as pixels are written, so show()
+   *         can check it without scanning the buffer; frames that would
+   *         exceed the budget are issued at reduced brightness (the
+   *         setBrightness() value is left unchanged). Enabling this scans
+   *         the buffer once. Writes made through an Adafruit_DotStar
+   *         pointer or reference, or directly to getPixels(), aren't seen;
+   *         call this again afterward to resync.
+   * @param  milliamps   Current budget for LEDs, or 0 to disable the
+   *                     limit (default state).
+   * @param  perChannel  Current drawn by one color channel of one LED at
+   *                     full intensity, in mA (DotStars are about 20).
+   */
+  void setPowerLimit(uint16_t milliamps, uint8_t perChannel = 20);
+
+  /**
+   * @brief   Estimated current for the pixel buffer as it stands, at the
+   *          current brightness and before any power limit is applied.
+   *          Only maintained while a limit is set.
+   * @return  uint32_t  Estimate in milliamps.
+   */
+  uint32_t getPowerEstimate(void) const;
+
+  /**
+   * @brief   Correct one tile's color and brightness, e.g. to match panels
+   *          from different LED batches. Applied to a copy of the pixel
+   *          buffer as it's issued in show(), so drawing and readback
+   *          are unaffected and there's no per-pixel cost while drawing.
+   *          The first call allocates a second pixel buffer and sets
+   *          every tile to uncorrected. The power limit, if set, is
+   *          estimated from uncorrected colors.
+   * @param   tile        Tile number, counting along the strip from 0. A
+   *                      non-tiled matrix is a single tile 0.
+   * @param   m           Output R, G, B rows of a 3x3 matrix applied to
+   *                      input R, G, B, in 8.8 fixed point (256 = 1.0).
+   * @param   level       Additional scaling, 0-255 (255 = unchanged).
+   * @return  true on success, false if tile is out of range or memory
+   *          couldn't be allocated.
+   */
+  bool setTileCalibration(uint16_t tile, const int16_t m[9],
+                          uint8_t level = 255);
+
+  /**
+   * @brief   Correct one tile's color and brightness with per-channel
+   *          gains. Same as above with a diagonal matrix.
+   * @param   tile        Tile number, counting along the strip from 0.
+   * @param   r           Red gain, 0-255 (255 = unchanged).
+   * @param   g           Green gain, 0-255 (255 = unchanged).
+   * @param   b           Blue gain, 0-255 (255 = unchanged).
+   * @param   level       Additional scaling, 0-255 (255 = unchanged).
+   * @return  true on success, false if tile is out of range or memory
+   *          couldn't be allocated.
+   */
+  bool setTileCalibration(uint16_t tile, uint8_t r, uint8_t g, uint8_t b,
+                          uint8_t level = 255);
+
+  /**
+   * @brief  Remove all tile calibration and release its memory.
+   */
+  void clearCalibration(void);
+
+  /**
+   * @brief   Set a per-LED uniformity correction map: a gain for each
+   *          color channel of every LED, e.g. measured to even out LEDs
+   *          that have aged unequally. Applied in show() after any tile
+   *          calibration, with the same copy-and-restore so drawing is
+   *          unaffected. The map is copied (3 bytes per LED, plus a
+   *          second pixel buffer if tile calibration hasn't already
+   *          allocated one).
+   * @param   gains  R, G, B gain (255 = unchanged) for each LED, in strip
+   *                 order -- not X/Y order -- so maps survive changes of
+   *                 layout or rotation.
+   * @return  true on success, false if memory couldn't be allocated.
+   */
+  bool setCorrectionMap(const uint8_t *gains);
+
+  /**
+   * @brief   Load a per-LED correction map (same format as
+   *          setCorrectionMap()) from a Stream such as an SD card File or
+   *          Serial.
+   * @param   s  Stream to read numPixels() * 3 bytes from.
+   * @return  true on success, false if memory couldn't be allocated or
+   *          the Stream ended early (no map is then in effect).
+   */
+  bool loadCorrectionMap(Stream &s);
+
+  /**
+   * @brief  Remove the per-LED correction map and release its memory.
+   */
+  void clearCorrectionMap(void);
+
+  /**
+   * @brief  Set a pixel's color by strip index, as in Adafruit_DotStar,
+   *         keeping the power estimate current. For a matrix sharing
+   *         another's strip, indices are relative to its own first pixel.
+   * @param  n  Pixel index along strip.
+   * @param  c  Pixel color in packed 32-bit 0RGB format.
+   */
+  void setPixelColor(uint16_t n, uint32_t c);
+
+  /**
+   * @brief  Set a pixel's color by strip index, as in Adafruit_DotStar,
+   *         keeping the power estimate current.
+   * @param  n  Pixel index along strip.
+   * @param  r  Red component (0 to 255).
+   * @param  g  Green component (0 to 255).
+   * @param  b  Blue component (0 to 255).
+   */
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+
+  /**
+   * @brief   Get a pixel's color by strip index, as in Adafruit_DotStar.
+   *          For a matrix sharing another's strip, indices are relative
+   *          to its own first pixel.
+   * @param   n  Pixel index along strip.
+   * @return  uint32_t  Pixel color in packed 32-bit 0RGB format.
+   */
+  uint32_t getPixelColor(uint16_t n) const;
+
+  /**
+   * @brief   Read back a pixel by X/Y, e.g. for effects that feed on their
+   *          own output (blur, cellular automata) without keeping a
+   *          separate copy of the screen. Coordinates are as for
+   *          drawPixel(); anything queued on the display list is drawn
+   *          first.
+   * @param   x  Column.
+   * @param   y  Row.
+   * @return  uint32_t  Color in packed 32-bit 0RGB format as stored, i.e.
+   *                    after gamma correction (pass-through colors come
+   *                    back unchanged), or 0 if off screen.
+   */
+  uint32_t getPixel(int16_t x, int16_t y);
+
+  /**
+   * @brief   Read back a pixel by X/Y as a 16-bit GFX color, undoing gamma
+   *          correction, so a color drawn with drawPixel() etc. reads back
+   *          the same.
+   * @param   x  Column.
+   * @param   y  Row.
+   * @return  uint16_t  Color in 16-bit '565' RGB format, or 0 if off
+   *                    screen.
+   */
+  uint16_t getPixel565(int16_t x, int16_t y);
+
+  /**
+   * @brief   Soften the whole matrix in place with a 1-2-1 blur across and
+   *          down (a 3x3 approximate Gaussian), for glow, smoke and fire
+   *          effects. Edge pixels extend outward, so overall brightness
+   *          holds. Works on the pixel buffer as stored, ignoring the
+   *          viewport and clip region.
+   * @return  bool  true on success, false if a line buffer couldn't be
+   *                allocated.
+   */
+  bool blur(void);
+
+  /**
+   * @brief   Box blur the whole matrix in place: each pixel becomes the
+   *          average of the (2 * radius + 1) squared pixels around it.
+   *          Cost doesn't grow with radius. As blur() otherwise.
+   * @param   radius  Blur radius in pixels, 0 (no change) to 127.
+   * @return  bool  true on success, false if a line buffer couldn't be
+   *                allocated.
+   */
+  bool boxBlur(uint8_t radius);
+
+  /**
+   * @brief   Apply a 3x3 convolution kernel to the whole matrix in place,
+   *          e.g. sharpen, edge detect or emboss. The kernel is oriented
+   *          as seen on screen (current rotation), and edge pixels
+   *          extend outward. As blur() otherwise.
+   * @param   kernel   Nine weights, row by row, top left first.
+   * @param   divisor  Weighted sums are divided by this (0 is taken as 1),
+   *                   usually the sum of the weights.
+   * @param   bias     Added to each channel after dividing, e.g. 128 to
+   *                   center an emboss. Results are clipped to 0-255.
+   * @return  bool  true on success, false if a line buffer couldn't be
+   *                allocated.
+   */
+  bool convolve(const int8_t *kernel, int16_t divisor = 1, int16_t bias = 0);
+
+  /**
+   * @brief  Set all pixels to off, as in Adafruit_DotStar, discarding any
+   *         pending display list commands. For a matrix sharing another's
+   *         strip, only its own pixels are cleared; on the owner, the
+   *         whole strip is.
+   */
+  void clear(void);
+
+  /**
+   * @brief  Fill a range of the strip with one color, as in
+   *         Adafruit_DotStar, keeping the power estimate current. For a
+   *         matrix sharing another's strip, indices are relative to its
+   *         own first pixel and stop at its last. Doesn't discard pending
+   *         display list commands.
+   * @param  c      Color in packed 32-bit 0RGB format.
+   * @param  first  Index of first pixel to fill.
+   * @param  count  Number of pixels, or 0 for the rest of the strip.
+   */
+  void fill(uint32_t c = 0, uint16_t first = 0, uint16_t count = 0);
+
   /**
    * @brief  Pass-through is a kludge that lets you override the current
    *         drawing color with a 'raw' RGB (or RGBW) value that's issued
@@ -185,6 +739,111 @@ public:
    */
   void setRemapFunction(uint16_t (*fn)(uint16_t, uint16_t));
 
+  /**
+   * @brief  Draw a horizontal run of palette-indexed pixels, e.g. one
+   *         decoded scanline of an image. Clipping and rotation are
+   *         resolved once for the whole run rather than per pixel, and
+   *         palette entries are issued as-is (no gamma correction, same
+   *         as pass-through color).
+   * @param  x            Column of first pixel (may be off left edge).
+   * @param  y            Row (0 = top edge, unless rotation used).
+   * @param  idx          Palette indices, one byte per pixel.
+   * @param  w            Number of pixels in run.
+   * @param  palette      Up to 256 colors in packed 32-bit 0RGB format.
+   * @param  transparent  Palette index to skip (leave pixel unchanged),
+   *                      or -1 (default) to draw every pixel.
+   */
+  void drawPaletteRow(int16_t x, int16_t y, const uint8_t *idx, int16_t w,
+                      const uint32_t *palette, int16_t transparent = -1);
+
+  /**
+   * @brief  Draw a '565' RGB image resized to fit a w x h rectangle, e.g.
+   *         a higher-resolution picture shrunk down to the matrix. Each
+   *         output pixel is the average of the source pixels it covers
+   *         (a box filter), so fine detail blends instead of aliasing.
+   *         The source is read once, row by row, and uses a small row of
+   *         accumulators (12 bytes per output column) rather than a copy.
+   * @param  x       Left edge of output.
+   * @param  y       Top edge of output.
+   * @param  bitmap  Source pixels, srcW x srcH, row-major, in RAM.
+   * @param  srcW    Source width.
+   * @param  srcH    Source height.
+   * @param  w       Output width.
+   * @param  h       Output height.
+   * @param  linear  If true, average in linear light (gamma-corrected
+   *                 via lookup tables before summing), which keeps thin
+   *                 bright details from dimming. Default false averages
+   *                 the stored values, then gamma-corrects the result.
+   */
+  void drawScaledRGBBitmap(int16_t x, int16_t y, const uint16_t *bitmap,
+                           int16_t srcW, int16_t srcH, int16_t w, int16_t h,
+                           bool linear = false);
+
+  /**
+   * @brief  Draw a 24-bit RGB image resized to fit a w x h rectangle. Same
+   *         as the '565' version, for sources with 3 bytes (R, G, B) per
+   *         pixel.
+   * @param  x       Left edge of output.
+   * @param  y       Top edge of output.
+   * @param  rgb     Source pixels, srcW x srcH x 3 bytes, row-major, in
+   *                 RAM.
+   * @param  srcW    Source width.
+   * @param  srcH    Source height.
+   * @param  w       Output width.
+   * @param  h       Output height.
+   * @param  linear  If true, average in linear light (see above).
+   */
+  void drawScaledRGBBitmap(int16_t x, int16_t y, const uint8_t *rgb,
+                           int16_t srcW, int16_t srcH, int16_t w, int16_t h,
+                           bool linear = false);
+
+  /**
+   * @brief  Copy a rectangular patch of pixels from a buffer, e.g. one
+   *         received from a coprocessor. Clipping is done once for the
+   *         whole rectangle, and each row follows the strip from pixel to
+   *         pixel rather than remapping every one. Where a row runs along
+   *         the strip in increasing order, raw pixels (DS_REGION_RAW, or
+   *         DS_REGION_888 if the strip's color order is RGB) are copied
+   *         into the pixel buffer with memcpy().
+   * @param  x        Left edge.
+   * @param  y        Top edge.
+   * @param  w        Width in pixels.
+   * @param  h        Height in pixels.
+   * @param  buf      Source pixels, w x h, row-major, in RAM.
+   * @param  format   DS_REGION_565, DS_REGION_888, DS_REGION_PALETTE or
+   *                  DS_REGION_RAW. 24-bit, palette and raw colors are
+   *                  issued as-is (no gamma correction, same as
+   *                  pass-through color).
+   * @param  palette  For DS_REGION_PALETTE, up to 256 colors in packed
+   *                  32-bit 0RGB format.
+   */
+  void updateRegion(int16_t x, int16_t y, int16_t w, int16_t h,
+                    const void *buf, uint8_t format,
+                    const uint32_t *palette = NULL);
+
+  /**
+   * @brief  Draw a '565' RGB image rotated and scaled about its center
+   *         (a "rotozoom"), e.g. a spinning logo. Sine and cosine are
+   *         evaluated once per call; each screen pixel then finds its
+   *         source pixel by stepping fixed-point coordinates, and runs of
+   *         opaque pixels are written as spans.
+   * @param  cx        Column where the image center is placed.
+   * @param  cy        Row where the image center is placed.
+   * @param  bitmap    Source pixels, srcW x srcH, row-major, in RAM.
+   * @param  srcW      Source width.
+   * @param  srcH      Source height.
+   * @param  angle     Rotation in degrees, clockwise.
+   * @param  zoom      Scale factor, e.g. 2.0 for double size. Values
+   *                   below DS_ROTOZOOM_MIN (1/1024) are drawn at that.
+   * @param  bilinear  If true, blend the four nearest source pixels
+   *                   (smoother, slower); default false picks the nearest.
+   * @param  colorkey  Source color to treat as transparent, or -1 (default)
+   *                   for an opaque image.
+   */
+  void drawRotoZoom(int16_t cx, int16_t cy, const uint16_t *bitmap,
+                    int16_t srcW, int16_t srcH, float angle, float zoom,
+                    bool bilinear = false, int32_t colorkey = -1);
+
   /**
    * @brief   Quantize a 24-bit RGB color value to 16-bit '565' format.
    * @param   r         Red component (0 to 255).
@@ -195,12 +854,83 @@ public:
   static uint16_t Color(uint8_t r, uint8_t g, uint8_t b);
 
 private:
-  const uint8_t type;
-  const uint8_t matrixWidth, matrixHeight, tilesX, tilesY;
+  friend class Adafruit_DotStarMatrixFast;
+
+  /**
+   * @brief Display list entry: a solid fill in unrotated coordinates.
+   */
+  struct DSCommand {
+    int16_t x;      ///< Left edge
+    int16_t y;      ///< Top edge
+    int16_t w;      ///< Width (0 = culled)
+    int16_t h;      ///< Height
+    uint32_t color; ///< Expanded 24-bit color
+  };
+
+  uint16_t remap(uint16_t x, uint16_t y);
+  uint32_t color32(uint16_t color) const;
+  uint16_t remapRotated(int16_t x, int16_t y);
+  void unrotate(int16_t &x, int16_t &y) const;
+  void unrotateRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const;
+  void writeXY(int16_t x, int16_t y, uint32_t c);
+  bool buildSymmetry(void);
+  bool fillBlock(int16_t x, int16_t y, int16_t w, int16_t h,
+                 uint16_t color);
+  void fillSpan(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t c);
+  void fillCircleSpans(int16_t cx, int16_t cy, int16_t r, uint8_t corners,
+                       int16_t delta, uint32_t c);
+  void fillUnrotated(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t c);
+  void drawRow(int16_t x, int16_t y, int16_t w, const uint8_t *idx,
+               const uint32_t *colors, int16_t transparent);
+  void downsample(int16_t x, int16_t y, const uint8_t *rgb,
+                  const uint16_t *rgb565, int16_t srcW, int16_t srcH,
+                  int16_t w, int16_t h, bool linear);
+  bool blurLines(uint8_t radius);
+  uint32_t regionColor(const uint8_t *p, uint8_t format,
+                       const uint32_t *palette) const;
+  void copyRaw(uint16_t n, const uint8_t *src, uint16_t len);
+  uint16_t numTiles(void) const;
+  void attach(Adafruit_DotStarMatrix &s, uint16_t first);
+  bool toScreen(int16_t &x, int16_t &y, int16_t &w, int16_t &h);
+  bool changeLayout(int16_t w, int16_t h, uint8_t mW, uint8_t mH, uint8_t tX,
+                    uint8_t tY, uint8_t matrixType);
+  uint8_t *allocCorrectionMap(void);
+  void growCalibration(uint16_t old);
+  void calibrate(void);
+
+  uint8_t type;
+  uint8_t matrixWidth, matrixHeight, tilesX, tilesY;
   uint16_t (*remapFn)(uint16_t x, uint16_t y);
+  const uint8_t rByte, gByte, bByte; // R, G, B offsets within each pixel
+  uint16_t ownPixels = 0; // LEDs given to constructor, not incl. views
 
   uint32_t passThruColor;
   boolean passThruFlag = false;
+
+  Adafruit_DotStarMatrix *strip = NULL; // Owner of shared strip, if any
+  uint16_t stripOffset = 0, stripLength = 0; // Range of it used here
+
+  int16_t viewX = 0, viewY = 0; // Virtual canvas offset (setViewport())
+  int16_t clipX = 0, clipY = 0; // Redraw region during panViewport(),
+  int16_t clipW = 0, clipH = 0; // screen coordinates; clipW = 0 if none
+
+  uint8_t scaleX = 1, scaleY = 1; // Physical pixels per logical (setScale())
+
+  uint16_t *symTable = NULL; // Mirror strip indices, NULL if no symmetry
+  uint8_t symmetry = DS_SYMMETRY_NONE; // Mode set by user
+  uint8_t symFold = 0, symCount = 0;   // Mode (unrotated), images per pixel
+  int16_t symW = 0, symH = 0;          // Size of region table covers
+
+  DSCommand *dlist = NULL; // Display list, NULL if not recording
+  uint16_t dlistSize = 0, dlistCount = 0;
+
+  uint32_t powerSum = 0;         // Sum of all channels in pixel buffer
+  uint16_t powerLimit = 0;       // Current budget in mA, 0 = unlimited
+  uint8_t channelMilliamps = 20; // mA per channel at full intensity
+
+  int16_t *calib = NULL;     // Per-tile 3x3 color matrices, 8.8 fixed
+  uint8_t *corrMap = NULL;   // Per-LED gains, in pixel buffer byte order
+  uint8_t *calibCopy = NULL; // Uncalibrated pixels, restored after show
 };
 
 #endif // _ADAFRUIT_DSMATRIX_H_
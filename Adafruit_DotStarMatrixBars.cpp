@@ -0,0 +1,125 @@
+/*!
+ * @file Adafruit_DotStarMatrixBars.cpp
+ *
+ * Incrementally updated bar graphs for Adafruit_DotStarMatrix.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <Adafruit_DotStarMatrixBars.h>
+
+Adafruit_DotStarMatrixBars::Adafruit_DotStarMatrixBars(
+    Adafruit_DotStarMatrix &m)
+    : matrix(m) {}
+
+Adafruit_DotStarMatrixBars::~Adafruit_DotStarMatrixBars(void) { free(bars); }
+
+void Adafruit_DotStarMatrixBars::setArea(int16_t x, int16_t y, int16_t w,
+                                         int16_t h) {
+  areaX = x;
+  areaY = y;
+  areaW = w;
+  areaH = h;
+  valid = false;
+}
+
+void Adafruit_DotStarMatrixBars::setColors(uint16_t bar, uint16_t background,
+                                           uint16_t peak) {
+  barColor = bar;
+  bgColor = background;
+  peakColor = peak;
+  valid = false;
+}
+
+// Each bar's cells are compared with what the previous call drew: the
+// rows between the old and new heights are filled as one vertical run
+// (per column of the bar) in whichever color they become, and the peak
+// marker is moved if needed. The drawing functions turn each run into a
+// walk along the strip, which on DS_MATRIX_COLUMNS panels is just
+// consecutive pixels.
+bool Adafruit_DotStarMatrixBars::drawBars(const uint8_t *heights, uint16_t n,
+                                          uint8_t style) {
+  if (n != count) {
+    free(bars);
+    count = 0;
+    valid = false;
+    if (!n)
+      return true;
+    if (!(bars = (DSBar *)malloc(n * sizeof(DSBar))))
+      return false;
+    count = n;
+  }
+  if ((style ^ lastStyle) & DS_BARS_GAP)
+    valid = false; // Bars change width
+
+  int16_t w = areaW ? areaW : matrix.width() - areaX,
+          h = areaH ? areaH : matrix.height() - areaY, bottom = areaY + h;
+  if (!valid) {
+    matrix.fillRect(areaX, areaY, w, h, bgColor);
+    for (uint16_t i = 0; i < n; i++) {
+      bars[i].height = bars[i].top = 0;
+      bars[i].peak = -1;
+      bars[i].hold = 0;
+    }
+    valid = true;
+  }
+  lastStyle = style;
+
+  for (uint16_t i = 0; i < n; i++) {
+    DSBar &b = bars[i];
+    // Bars share the width as evenly as whole pixels allow
+    int16_t left = areaX + (int32_t)w * i / n,
+            bw = areaX + (int32_t)w * (i + 1) / n - left;
+    if ((style & DS_BARS_GAP) && (bw > 1))
+      bw--;
+    if (bw <= 0)
+      continue; // More bars than columns
+
+    int16_t nh = ((int32_t)heights[i] * h + 127) / 255, peak = -1;
+    if (style & DS_BARS_PEAK) { // Held peak, falls once hold runs out
+      if (nh >= b.top) {
+        b.top = nh;
+        b.hold = peakHold;
+      } else if (b.hold) {
+        b.hold--;
+      } else {
+        b.top--;
+      }
+      peak = (b.top < h) ? b.top : h - 1;
+    }
+
+    // Rows [lo, hi) change between bar and background
+    int16_t lo = (nh < b.height) ? nh : b.height,
+            hi = (nh < b.height) ? b.height : nh;
+    if (hi > lo)
+      matrix.fillRect(left, bottom - hi, bw, hi - lo,
+                      (nh > b.height) ? barColor : bgColor);
+    if ((b.peak >= 0) && (b.peak != peak) && ((b.peak < lo) || (b.peak >= hi)))
+      matrix.fillRect(left, bottom - 1 - b.peak, bw, 1,
+                      (b.peak < nh) ? barColor : bgColor); // Erase old
+    if ((peak >= 0) && ((peak != b.peak) || ((peak >= lo) && (peak < hi))))
+      matrix.fillRect(left, bottom - 1 - peak, bw, 1, peakColor);
+    b.height = nh;
+    b.peak = peak;
+  }
+  return true;
+}
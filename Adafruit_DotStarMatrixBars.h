@@ -0,0 +1,123 @@
+/*!
+ * @file Adafruit_DotStarMatrixBars.h
+ *
+ * Bar graph / spectrum display for Adafruit_DotStarMatrix. The heights
+ * last drawn are remembered, so each frame only the cells where a bar grew
+ * or shrank (and any moving peak markers) are written.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef _ADAFRUIT_DSMATRIX_BARS_H_
+#define _ADAFRUIT_DSMATRIX_BARS_H_
+
+#include <Adafruit_DotStarMatrix.h>
+
+// Style flags for drawBars(), may be added together:
+
+#define DS_BARS_SOLID 0x00 ///< Plain bars, side by side
+#define DS_BARS_PEAK 0x01  ///< Peak-hold marker above each bar
+#define DS_BARS_GAP 0x02   ///< Blank column between bars (if 2+ wide)
+
+/**
+ * @brief Class for drawing bar graphs (e.g. audio spectra) on a matrix.
+ */
+class Adafruit_DotStarMatrixBars {
+
+public:
+  /**
+   * @brief  Construct a bar graph bound to a matrix. It covers the whole
+   *         screen unless setArea() says otherwise.
+   * @param  m  Matrix to draw on.
+   */
+  Adafruit_DotStarMatrixBars(Adafruit_DotStarMatrix &m);
+  ~Adafruit_DotStarMatrixBars(void);
+
+  /**
+   * @brief  Set the rectangle bars are drawn in; they stand on its bottom
+   *         edge and share its width equally. Redraws it all next time.
+   * @param  x  Left edge.
+   * @param  y  Top edge.
+   * @param  w  Width, or 0 for the rest of the screen.
+   * @param  h  Height, or 0 for the rest of the screen.
+   */
+  void setArea(int16_t x, int16_t y, int16_t w = 0, int16_t h = 0);
+
+  /**
+   * @brief  Set bar, background and peak marker colors. Redraws it all
+   *         next time.
+   * @param  bar         16-bit '565' RGB color for bars.
+   * @param  background  16-bit '565' RGB color for the area above them.
+   * @param  peak        16-bit '565' RGB color for peak markers.
+   */
+  void setColors(uint16_t bar, uint16_t background = 0,
+                 uint16_t peak = 0xFFFF);
+
+  /**
+   * @brief  Set how peak markers move: they stay put for some frames
+   *         after a bar drops, then fall a pixel per frame.
+   * @param  frames  drawBars() calls before a peak marker starts to fall.
+   */
+  void setPeakHold(uint8_t frames) { peakHold = frames; }
+
+  /**
+   * @brief   Draw the bars. The first call (or any after the number of
+   *          bars, gap style, area or colors change, or reset()) fills
+   *          the whole area; after that, only cells that differ from the
+   *          previous call are written, as vertical runs. Does not call
+   *          show().
+   * @param   heights  Bar heights, 0 (empty) to 255 (full height).
+   * @param   n        Number of bars.
+   * @param   style    DS_BARS_SOLID, or DS_BARS_PEAK and/or DS_BARS_GAP.
+   * @return  true on success, false if out of memory.
+   */
+  bool drawBars(const uint8_t *heights, uint16_t n,
+                uint8_t style = DS_BARS_SOLID);
+
+  /**
+   * @brief  Forget what's on the matrix (e.g. after it's been cleared), so
+   *         the next drawBars() redraws the whole area.
+   */
+  void reset(void) { valid = false; }
+
+private:
+  /**
+   * @brief Per-bar state, in pixels up from the bottom of the area.
+   */
+  struct DSBar {
+    int16_t height; ///< Bar height drawn
+    int16_t peak;   ///< Peak marker row drawn, -1 if none
+    int16_t top;    ///< Peak held, before clipping to area
+    uint8_t hold;   ///< Frames left before peak starts to fall
+  };
+
+  Adafruit_DotStarMatrix &matrix;
+  DSBar *bars = NULL;
+  uint16_t count = 0; // Number of bars in 'bars'
+  uint8_t lastStyle = 0;
+  bool valid = false; // 'bars' matches what's on the matrix
+  int16_t areaX = 0, areaY = 0, areaW = 0, areaH = 0;
+  uint16_t barColor = 0xFFFF, bgColor = 0, peakColor = 0xFFFF;
+  uint8_t peakHold = 10;
+};
+
+#endif // _ADAFRUIT_DSMATRIX_BARS_H_
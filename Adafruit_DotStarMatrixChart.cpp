@@ -0,0 +1,138 @@
+/*!
+ * @file Adafruit_DotStarMatrixChart.cpp
+ *
+ * Scrolling strip chart for Adafruit_DotStarMatrix.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <Adafruit_DotStarMatrixChart.h>
+
+Adafruit_DotStarMatrixChart::Adafruit_DotStarMatrixChart(
+    Adafruit_DotStarMatrix &m)
+    : matrix(m) {}
+
+Adafruit_DotStarMatrixChart::~Adafruit_DotStarMatrixChart(void) {
+  free(samples);
+}
+
+bool Adafruit_DotStarMatrixChart::begin(int16_t x, int16_t y, int16_t w,
+                                        int16_t h) {
+  free(samples);
+  samples = NULL;
+  head = used = 0;
+  valid = false;
+  areaX = x;
+  areaY = y;
+  areaW = w ? w : matrix.width() - x;
+  areaH = h ? h : matrix.height() - y;
+  if ((areaW <= 0) || (areaH <= 0))
+    return false;
+  // One more sample than columns: the one scrolled off the left edge is
+  // still needed to join lines to
+  return (samples = (int16_t *)malloc((areaW + 1) * sizeof(int16_t))) != NULL;
+}
+
+void Adafruit_DotStarMatrixChart::setRange(int16_t bottom, int16_t top) {
+  rangeBottom = bottom;
+  rangeTop = top;
+  valid = false;
+}
+
+void Adafruit_DotStarMatrixChart::setColors(uint16_t fg, uint16_t bg) {
+  fgColor = fg;
+  bgColor = bg;
+  valid = false;
+}
+
+void Adafruit_DotStarMatrixChart::setStyle(uint8_t s) {
+  style = s;
+  valid = false;
+}
+
+// Sample value to pixel rows up from the bottom edge, clipped
+int16_t Adafruit_DotStarMatrixChart::toRow(int16_t v) const {
+  int32_t span = (int32_t)rangeTop - rangeBottom;
+  if (!span)
+    return 0;
+  int32_t r = (((int32_t)v - rangeBottom) * (areaH - 1) * 2 + span) /
+              (2 * span); // Rounded
+  return (r < 0) ? 0 : (r >= areaH) ? areaH - 1 : r;
+}
+
+// Plot one sample's column, which is already background color. prevRow
+// is the sample to its left, for joining up lines, or -1 if none.
+void Adafruit_DotStarMatrixChart::drawColumn(int16_t x, int16_t row,
+                                             int16_t prevRow) {
+  int16_t bottom = areaY + areaH - 1, lo = row, hi = row;
+  if (style == DS_CHART_FILL) {
+    lo = 0;
+  } else if ((style == DS_CHART_LINE) && (prevRow >= 0)) {
+    // Vertical run from next to the previous sample up (or down) to this
+    // one, so steep changes stay joined
+    if (prevRow < row - 1)
+      lo = prevRow + 1;
+    else if (prevRow > row + 1)
+      hi = prevRow - 1;
+  }
+  matrix.drawFastVLine(x, bottom - hi, hi - lo + 1, fgColor);
+}
+
+void Adafruit_DotStarMatrixChart::redraw(void) {
+  if (!samples)
+    return;
+  matrix.fillRect(areaX, areaY, areaW, areaH, bgColor);
+  int16_t prevRow = -1, x = areaX + areaW - used;
+  uint16_t i = (head + areaW + 1 - used) % (areaW + 1); // Oldest sample
+  for (uint16_t n = used; n--; x++) {
+    int16_t row = toRow(samples[i]);
+    if (x >= areaX) // Else it's off the left edge, just a line end
+      drawColumn(x, row, prevRow);
+    prevRow = row;
+    if (++i > areaW)
+      i = 0;
+  }
+  valid = true;
+}
+
+// The chart's already on the matrix: scroll it within the pixel buffer
+// (scrollRect() works in screen coordinates, the rest in the viewport's)
+// and draw the one new column. Otherwise draw the lot.
+void Adafruit_DotStarMatrixChart::addSample(int16_t v) {
+  if (!samples)
+    return;
+  int16_t prevRow = used ? toRow(samples[head ? head - 1 : areaW]) : -1;
+  samples[head] = v;
+  if (++head > areaW)
+    head = 0;
+  if (used <= areaW)
+    used++;
+
+  if (!valid) {
+    redraw();
+    return;
+  }
+  matrix.scrollRect(areaX - matrix.getViewportX(),
+                    areaY - matrix.getViewportY(), areaW, areaH, -1, 0,
+                    bgColor);
+  drawColumn(areaX + areaW - 1, toRow(v), prevRow);
+}
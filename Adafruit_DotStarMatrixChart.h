@@ -0,0 +1,125 @@
+/*!
+ * @file Adafruit_DotStarMatrixChart.h
+ *
+ * Scrolling strip chart for Adafruit_DotStarMatrix. Samples are kept in a
+ * ring buffer; each new one scrolls the chart left a column within the
+ * pixel buffer and draws just the new column, rather than redrawing the
+ * whole chart.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef _ADAFRUIT_DSMATRIX_CHART_H_
+#define _ADAFRUIT_DSMATRIX_CHART_H_
+
+#include <Adafruit_DotStarMatrix.h>
+
+// Plot styles for setStyle():
+
+#define DS_CHART_DOT 0  ///< One pixel per sample
+#define DS_CHART_LINE 1 ///< Each sample joined to the one before
+#define DS_CHART_FILL 2 ///< Filled from the bottom up to each sample
+
+/**
+ * @brief Class for plotting a rolling time series on a matrix.
+ */
+class Adafruit_DotStarMatrixChart {
+
+public:
+  /**
+   * @brief  Construct a chart bound to a matrix. Call begin() before use.
+   * @param  m  Matrix to draw on.
+   */
+  Adafruit_DotStarMatrixChart(Adafruit_DotStarMatrix &m);
+  ~Adafruit_DotStarMatrixChart(void);
+
+  /**
+   * @brief   Set the chart's rectangle and allocate a sample for each
+   *          column of it, discarding any samples so far. The newest
+   *          sample is plotted at the right edge.
+   * @param   x  Left edge.
+   * @param   y  Top edge.
+   * @param   w  Width, or 0 for the rest of the screen.
+   * @param   h  Height, or 0 for the rest of the screen.
+   * @return  true on success, false if out of memory.
+   */
+  bool begin(int16_t x = 0, int16_t y = 0, int16_t w = 0, int16_t h = 0);
+
+  /**
+   * @brief  Set the sample values at the bottom and top edges of the
+   *         chart; values outside are clipped to the edges. Redraws it
+   *         all with the next sample. Default is 0 to 255.
+   * @param  bottom  Value plotted on the bottom row.
+   * @param  top     Value plotted on the top row.
+   */
+  void setRange(int16_t bottom, int16_t top);
+
+  /**
+   * @brief  Set plot and background colors. Redraws it all with the next
+   *         sample.
+   * @param  fg  16-bit '565' RGB color for the plot.
+   * @param  bg  16-bit '565' RGB color for the rest of the chart.
+   */
+  void setColors(uint16_t fg, uint16_t bg = 0);
+
+  /**
+   * @brief  Set plot style. Redraws it all with the next sample.
+   * @param  s  DS_CHART_DOT, DS_CHART_LINE or DS_CHART_FILL.
+   */
+  void setStyle(uint8_t s);
+
+  /**
+   * @brief  Add a sample: scrolls the chart left one column and plots it
+   *         at the right edge (or redraws the whole chart, if settings
+   *         changed or after reset()). Does not call show().
+   * @param  v  Sample value.
+   */
+  void addSample(int16_t v);
+
+  /**
+   * @brief  Draw the whole chart from the samples held. Does not call
+   *         show().
+   */
+  void redraw(void);
+
+  /**
+   * @brief  Forget what's on the matrix (e.g. after it's been cleared), so
+   *         the next addSample() redraws the whole chart.
+   */
+  void reset(void) { valid = false; }
+
+private:
+  int16_t toRow(int16_t v) const;
+  void drawColumn(int16_t x, int16_t row, int16_t prevRow);
+
+  Adafruit_DotStarMatrix &matrix;
+  int16_t *samples = NULL; // Ring buffer, areaW + 1 samples
+  uint16_t head = 0;       // Index of next sample to write
+  uint16_t used = 0;       // Number of samples held
+  int16_t areaX = 0, areaY = 0, areaW = 0, areaH = 0;
+  int16_t rangeBottom = 0, rangeTop = 255;
+  uint16_t fgColor = 0xFFFF, bgColor = 0;
+  uint8_t style = DS_CHART_LINE;
+  bool valid = false; // Chart on matrix matches samples
+};
+
+#endif // _ADAFRUIT_DSMATRIX_CHART_H_
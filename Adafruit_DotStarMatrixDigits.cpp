@@ -0,0 +1,188 @@
+/*!
+ * @file Adafruit_DotStarMatrixDigits.cpp
+ *
+ * Change-only text readouts for Adafruit_DotStarMatrix.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <Adafruit_DotStarMatrixDigits.h>
+#include <Adafruit_DotStarMatrixFast.h> // dsMatrixFont
+
+#ifndef pgm_read_word
+#define pgm_read_word(addr)                                                    \
+  (*(const unsigned short *)(addr)) ///< PROGMEM concept doesn't apply here
+#endif
+#ifndef pgm_read_pointer
+#ifdef __AVR__
+#define pgm_read_pointer(addr) ((void *)pgm_read_word(addr)) ///< 16-bit
+#else
+#define pgm_read_pointer(addr) (*(void *const *)(addr)) ///< Plain pointer
+#endif
+#endif
+
+Adafruit_DotStarMatrixDigits::Adafruit_DotStarMatrixDigits(
+    Adafruit_DotStarMatrix &m)
+    : matrix(m) {}
+
+Adafruit_DotStarMatrixDigits::~Adafruit_DotStarMatrixDigits(void) {
+  free(shown);
+}
+
+bool Adafruit_DotStarMatrixDigits::begin(uint8_t cells, int16_t x, int16_t y,
+                                         uint8_t size, const GFXfont *f) {
+  free(shown);
+  count = 0;
+  valid = false;
+  originX = x;
+  originY = y;
+  textSize = size ? size : 1;
+  font = f;
+  if (font) { // Cell size from '0' (or the first glyph, if no digits)
+    uint16_t first = pgm_read_word(&font->first),
+             last = pgm_read_word(&font->last);
+    const GFXglyph *g = (const GFXglyph *)pgm_read_pointer(&font->glyph);
+    if (('0' >= first) && ('0' <= last))
+      g += '0' - first;
+    cellW = pgm_read_byte(&g->xAdvance) * textSize;
+    cellH = pgm_read_byte(&font->yAdvance) * textSize;
+    ascent = -(int8_t)pgm_read_byte(&g->yOffset);
+  } else {
+    cellW = 6 * textSize;
+    cellH = 8 * textSize;
+  }
+  if (!(shown = (char *)malloc(cells)))
+    return false;
+  count = cells;
+  return true;
+}
+
+void Adafruit_DotStarMatrixDigits::setColors(uint16_t fg, uint16_t bg) {
+  fgColor = fg;
+  bgColor = bg;
+  valid = false;
+}
+
+// Draw one character's set pixels over an already-cleared cell, as runs
+// rather than pixel by pixel: down each column of the built-in font
+// (stored a column per byte), or along each row of a GFX font's bitmap.
+void Adafruit_DotStarMatrixDigits::drawGlyph(int16_t x, int16_t y,
+                                             unsigned char c) {
+  uint8_t s = textSize;
+  if (!font) {
+    if (c >= 176)
+      c++; // Same glyph positions as Adafruit_GFX without cp437()
+    for (int8_t i = 0; i < 5; i++) {
+      uint8_t bits = pgm_read_byte(&dsMatrixFont[c * 5 + i]);
+      for (int8_t j = 0; bits; j++, bits >>= 1) {
+        if (!(bits & 1))
+          continue;
+        int8_t n = 0;
+        while (bits & 2) { // Run continues below
+          n++;
+          bits >>= 1;
+        }
+        matrix.fillRect(x + i * s, y + j * s, s, (n + 1) * s, fgColor);
+        j += n;
+      }
+    }
+    return;
+  }
+
+  uint16_t first = pgm_read_word(&font->first),
+           last = pgm_read_word(&font->last);
+  if ((c < first) || (c > last))
+    return;
+  const GFXglyph *g =
+      (const GFXglyph *)pgm_read_pointer(&font->glyph) + (c - first);
+  const uint8_t *bitmap = (const uint8_t *)pgm_read_pointer(&font->bitmap);
+  uint16_t bo = pgm_read_word(&g->bitmapOffset);
+  uint8_t w = pgm_read_byte(&g->width), h = pgm_read_byte(&g->height),
+          bits = 0, bit = 0;
+  int16_t left = x + (int8_t)pgm_read_byte(&g->xOffset) * s,
+          top = y + (ascent + (int8_t)pgm_read_byte(&g->yOffset)) * s;
+  for (uint8_t j = 0; j < h; j++) {
+    int16_t start = -1; // Start of run in progress, or -1
+    for (uint8_t i = 0; i <= w; i++) {
+      bool on = false;
+      if (i < w) { // Bits run on from row to row, MSB first
+        if (!(bit++ & 7))
+          bits = pgm_read_byte(&bitmap[bo++]);
+        on = bits & 0x80;
+        bits <<= 1;
+      }
+      if (on && (start < 0)) {
+        start = i;
+      } else if (!on && (start >= 0)) {
+        matrix.fillRect(left + start * s, top + j * s, (i - start) * s, s,
+                        fgColor);
+        start = -1;
+      }
+    }
+  }
+}
+
+// Show one character in cell i, unless it's there already
+void Adafruit_DotStarMatrixDigits::drawCell(uint8_t i, char c) {
+  if (valid && (c == shown[i]))
+    return;
+  int16_t x = originX + i * cellW;
+  matrix.fillRect(x, originY, cellW, cellH, bgColor);
+  if (c != ' ')
+    drawGlyph(x, originY, c);
+  shown[i] = c;
+}
+
+void Adafruit_DotStarMatrixDigits::draw(const char *str) {
+  bool ended = false;
+  for (uint8_t i = 0; i < count; i++) {
+    char c = ' ';
+    if (!ended && !(ended = !str[i]))
+      c = str[i];
+    drawCell(i, c);
+  }
+  valid = true;
+}
+
+// Cells are filled right to left straight from the value, no string
+void Adafruit_DotStarMatrixDigits::drawNumber(int32_t n, char pad) {
+  bool negative = n < 0;
+  uint32_t u = negative ? -(uint32_t)n : n;
+  uint8_t len = negative + 1; // Sign and digits
+  for (uint32_t t = u; t >= 10; t /= 10)
+    len++;
+  for (int16_t i = count - 1; i >= 0; i--) {
+    char c;
+    if (len > count) { // Doesn't fit, with either pad: all dashes
+      c = '-';
+    } else if (u || (i == (count - 1))) {
+      c = '0' + u % 10;
+      u /= 10;
+    } else if (negative && ((pad == '0') ? !i : (i == (count - len)))) {
+      c = '-'; // Sign goes before leading zeros, or right of spaces
+    } else {
+      c = pad;
+    }
+    drawCell(i, c);
+  }
+  valid = true;
+}
@@ -0,0 +1,126 @@
+/*!
+ * @file Adafruit_DotStarMatrixDigits.h
+ *
+ * Fixed-layout text for clocks, counters and other readouts on an
+ * Adafruit_DotStarMatrix. The string on display is remembered, and an
+ * update clears and redraws only the character cells that changed.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef _ADAFRUIT_DSMATRIX_DIGITS_H_
+#define _ADAFRUIT_DSMATRIX_DIGITS_H_
+
+#include <Adafruit_DotStarMatrix.h>
+
+/**
+ * @brief Class for drawing a fixed row of character cells on a matrix,
+ *        redrawing only those that change.
+ */
+class Adafruit_DotStarMatrixDigits {
+
+public:
+  /**
+   * @brief  Construct a readout bound to a matrix. Call begin() before
+   *         use.
+   * @param  m  Matrix to draw on.
+   */
+  Adafruit_DotStarMatrixDigits(Adafruit_DotStarMatrix &m);
+  ~Adafruit_DotStarMatrixDigits(void);
+
+  /**
+   * @brief   Set up the row of character cells.
+   * @param   cells  Number of characters.
+   * @param   x      Left edge of first cell.
+   * @param   y      Top edge of cells.
+   * @param   size   Magnification, 1 or more.
+   * @param   f      Adafruit_GFX font, or NULL for the built-in 5x7 font
+   *                 (6x8 pixel cells). GFX fonts should be fixed width:
+   *                 cells are as wide as the font's '0', and as tall as
+   *                 its line spacing, with the top of '0' at the top.
+   * @return  true on success, false if out of memory.
+   */
+  bool begin(uint8_t cells, int16_t x = 0, int16_t y = 0, uint8_t size = 1,
+             const GFXfont *f = NULL);
+
+  /**
+   * @brief  Set text and background colors. Cells are cleared to the
+   *         background color before a character is drawn. Redraws every
+   *         cell next time.
+   * @param  fg  16-bit '565' RGB text color.
+   * @param  bg  16-bit '565' RGB background color.
+   */
+  void setColors(uint16_t fg, uint16_t bg = 0);
+
+  /**
+   * @brief  Show a string, one character per cell from the left. Shorter
+   *         strings are padded with spaces; longer ones are cut off.
+   *         Only cells whose character changed are drawn. Does not call
+   *         show().
+   * @param  str  Null-terminated string.
+   */
+  void draw(const char *str);
+
+  /**
+   * @brief  Show a number right-aligned in the cells, as for draw(). If
+   *         it doesn't fit (sign included), every cell shows '-'.
+   * @param  n    Value.
+   * @param  pad  Character for unused cells on the left, e.g. '0' for
+   *              leading zeros.
+   */
+  void drawNumber(int32_t n, char pad = ' ');
+
+  /**
+   * @brief  Forget what's on the matrix (e.g. after it's been cleared), so
+   *         the next draw() redraws every cell.
+   */
+  void reset(void) { valid = false; }
+
+  /**
+   * @brief   Get width of one character cell.
+   * @return  int16_t  Width in pixels.
+   */
+  int16_t cellWidth(void) const { return cellW; }
+
+  /**
+   * @brief   Get height of the character cells.
+   * @return  int16_t  Height in pixels.
+   */
+  int16_t cellHeight(void) const { return cellH; }
+
+private:
+  void drawGlyph(int16_t x, int16_t y, unsigned char c);
+  void drawCell(uint8_t i, char c);
+
+  Adafruit_DotStarMatrix &matrix;
+  char *shown = NULL; // Character in each cell on the matrix
+  uint8_t count = 0;  // Number of cells
+  int16_t originX = 0, originY = 0;
+  int16_t cellW = 6, cellH = 8;
+  int8_t ascent = 0; // Font's '0' top to baseline, unmagnified
+  uint8_t textSize = 1;
+  const GFXfont *font = NULL;
+  uint16_t fgColor = 0xFFFF, bgColor = 0;
+  bool valid = false; // 'shown' matches what's on the matrix
+};
+
+#endif // _ADAFRUIT_DSMATRIX_DIGITS_H_
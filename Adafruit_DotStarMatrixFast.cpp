@@ -0,0 +1,65 @@
+/*!
+ * @file Adafruit_DotStarMatrixFast.cpp
+ *
+ * Pixel writer for statically dispatched matrix drawing.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <Adafruit_DotStarMatrixFast.h>
+#include <glcdfont.c> // Adafruit_GFX's font, declared static there
+
+// glcdfont.c declares the font static, so this is a second copy of it
+// (about 1.3 KB of flash) alongside the one in Adafruit_GFX. That's
+// deliberate: it's the only way to read the glyphs directly. Only
+// sketches that use this class or Adafruit_DotStarMatrixDigits pay for
+// it; the linker drops it otherwise, and Adafruit_DotStarMatrix's own
+// drawing never refers to it.
+const unsigned char *const dsMatrixFont = font;
+
+Adafruit_DotStarMatrixFast::Adafruit_DotStarMatrixFast(
+    Adafruit_DotStarMatrix &m)
+    : matrix(m) {
+  sync();
+}
+
+void Adafruit_DotStarMatrixFast::sync(void) {
+  Adafruit_DotStarMatrix &m = matrix;
+  m.flushDisplayList();
+  viewX = m.viewX;
+  viewY = m.viewY;
+  left = viewX + (m.clipW ? m.clipX : 0);
+  top = viewY + (m.clipW ? m.clipY : 0);
+  right = viewX + (m.clipW ? (m.clipX + m.clipW) : m.width());
+  bottom = viewY + (m.clipW ? (m.clipY + m.clipH) : m.height());
+  physW = m.WIDTH;
+  physH = m.HEIGHT;
+  rotation = m.getRotation();
+  type = m.type;
+  mW = m.matrixWidth;
+  mH = m.matrixHeight;
+  tX = m.tilesX;
+  tY = m.tilesY;
+  remapFn = m.remapFn;
+  scaled = (m.scaleX > 1) || (m.scaleY > 1);
+  mirrored = (m.symTable != NULL);
+}
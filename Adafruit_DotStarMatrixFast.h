@@ -0,0 +1,506 @@
+/*!
+ * @file Adafruit_DotStarMatrixFast.h
+ *
+ * Statically dispatched drawing for DotStar matrices. Adafruit_GFX draws
+ * every shape through the virtual drawPixel(), so the layout math can't be
+ * inlined into the shape loops. The drawing layer here is a template
+ * (CRTP): the shape algorithms are compiled against the concrete pixel
+ * writer, Adafruit_DotStarMatrixFast::plot(), so rotation, clipping and
+ * X/Y-to-strip mapping all inline into each loop.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef _ADAFRUIT_DSMATRIX_FAST_H_
+#define _ADAFRUIT_DSMATRIX_FAST_H_
+
+#include <Adafruit_DotStarMatrix.h>
+#include <Adafruit_DotStarMatrixLayout.h>
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#elif defined(ESP8266)
+#include <pgmspace.h>
+#endif
+
+extern const unsigned char *const dsMatrixFont; ///< Adafruit_GFX 5x7 font
+
+/**
+ * @brief Adafruit_GFX-compatible shape and text drawing, dispatched at
+ *        compile time. Derived must provide plot(x, y, c), writing one
+ *        24-bit color c at virtual canvas X/Y (clipping as needed), and
+ *        color(c), converting a 16-bit GFX color to 24-bit. For positive
+ *        sizes, results match the same Adafruit_GFX calls pixel for pixel.
+ */
+template <class Derived> class Adafruit_DotStarMatrixDraw {
+
+public:
+  /**
+   * @brief  Set one pixel.
+   * @param  x      Column.
+   * @param  y      Row.
+   * @param  color  16-bit '565' color.
+   */
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    self().plot(x, y, self().color(color));
+  }
+
+  /**
+   * @brief  Draw a horizontal line.
+   * @param  x      Left end.
+   * @param  y      Row.
+   * @param  w      Length in pixels.
+   * @param  color  16-bit '565' color.
+   */
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    hline(x, y, w, self().color(color));
+  }
+
+  /**
+   * @brief  Draw a vertical line.
+   * @param  x      Column.
+   * @param  y      Top end.
+   * @param  h      Length in pixels.
+   * @param  color  16-bit '565' color.
+   */
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    vline(x, y, h, self().color(color));
+  }
+
+  /**
+   * @brief  Draw a line between two points.
+   * @param  xa     Column of first point.
+   * @param  ya     Row of first point.
+   * @param  xb     Column of second point.
+   * @param  yb     Row of second point.
+   * @param  color  16-bit '565' color.
+   */
+  void drawLine(int16_t xa, int16_t ya, int16_t xb, int16_t yb,
+                uint16_t color) {
+    line(xa, ya, xb, yb, self().color(color));
+  }
+
+  /**
+   * @brief  Draw a rectangle outline.
+   * @param  x      Left edge.
+   * @param  y      Top edge.
+   * @param  w      Width.
+   * @param  h      Height.
+   * @param  color  16-bit '565' color.
+   */
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    uint32_t c = self().color(color);
+    hline(x, y, w, c);
+    hline(x, y + h - 1, w, c);
+    vline(x, y, h, c);
+    vline(x + w - 1, y, h, c);
+  }
+
+  /**
+   * @brief  Draw a filled rectangle.
+   * @param  x      Left edge.
+   * @param  y      Top edge.
+   * @param  w      Width.
+   * @param  h      Height.
+   * @param  color  16-bit '565' color.
+   */
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    fill(x, y, w, h, self().color(color));
+  }
+
+  /**
+   * @brief  Draw a circle outline.
+   * @param  cx     Center column.
+   * @param  cy     Center row.
+   * @param  r      Radius.
+   * @param  color  16-bit '565' color.
+   */
+  void drawCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+    uint32_t c = self().color(color);
+    int16_t f = 1 - r, ddx = 1, ddy = -2 * r, x = 0, y = r;
+    self().plot(cx, cy + r, c);
+    self().plot(cx, cy - r, c);
+    self().plot(cx + r, cy, c);
+    self().plot(cx - r, cy, c);
+    while (x < y) {
+      if (f >= 0) {
+        y--;
+        ddy += 2;
+        f += ddy;
+      }
+      x++;
+      ddx += 2;
+      f += ddx;
+      self().plot(cx + x, cy + y, c);
+      self().plot(cx - x, cy + y, c);
+      self().plot(cx + x, cy - y, c);
+      self().plot(cx - x, cy - y, c);
+      self().plot(cx + y, cy + x, c);
+      self().plot(cx - y, cy + x, c);
+      self().plot(cx + y, cy - x, c);
+      self().plot(cx - y, cy - x, c);
+    }
+  }
+
+  /**
+   * @brief  Draw a filled circle.
+   * @param  cx     Center column.
+   * @param  cy     Center row.
+   * @param  r      Radius.
+   * @param  color  16-bit '565' color.
+   */
+  void fillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+    uint32_t c = self().color(color);
+    int16_t f = 1 - r, ddx = 1, ddy = -2 * r, x = 0, y = r, px = x, py = y;
+    vline(cx, cy - r, 2 * r + 1, c);
+    while (x < y) {
+      if (f >= 0) {
+        y--;
+        ddy += 2;
+        f += ddy;
+      }
+      x++;
+      ddx += 2;
+      f += ddx;
+      if (x < (y + 1)) { // Avoid double-drawing certain lines
+        vline(cx + x, cy - y, 2 * y + 1, c);
+        vline(cx - x, cy - y, 2 * y + 1, c);
+      }
+      if (y != py) {
+        vline(cx + py, cy - px, 2 * px + 1, c);
+        vline(cx - py, cy - px, 2 * px + 1, c);
+        py = y;
+      }
+      px = x;
+    }
+  }
+
+  /**
+   * @brief  Draw a triangle outline.
+   * @param  xa     Column of first corner.
+   * @param  ya     Row of first corner.
+   * @param  xb     Column of second corner.
+   * @param  yb     Row of second corner.
+   * @param  xc     Column of third corner.
+   * @param  yc     Row of third corner.
+   * @param  color  16-bit '565' color.
+   */
+  void drawTriangle(int16_t xa, int16_t ya, int16_t xb, int16_t yb,
+                    int16_t xc, int16_t yc, uint16_t color) {
+    uint32_t c = self().color(color);
+    line(xa, ya, xb, yb, c);
+    line(xb, yb, xc, yc, c);
+    line(xc, yc, xa, ya, c);
+  }
+
+  /**
+   * @brief  Draw a filled triangle.
+   * @param  xa     Column of first corner.
+   * @param  ya     Row of first corner.
+   * @param  xb     Column of second corner.
+   * @param  yb     Row of second corner.
+   * @param  xc     Column of third corner.
+   * @param  yc     Row of third corner.
+   * @param  color  16-bit '565' color.
+   */
+  void fillTriangle(int16_t xa, int16_t ya, int16_t xb, int16_t yb,
+                    int16_t xc, int16_t yc, uint16_t color) {
+    uint32_t c = self().color(color);
+    int16_t a, b, y, last, t;
+
+    // Sort corners by Y (yc >= yb >= ya)
+    if (ya > yb) {
+      t = ya, ya = yb, yb = t;
+      t = xa, xa = xb, xb = t;
+    }
+    if (yb > yc) {
+      t = yc, yc = yb, yb = t;
+      t = xc, xc = xb, xb = t;
+    }
+    if (ya > yb) {
+      t = ya, ya = yb, yb = t;
+      t = xa, xa = xb, xb = t;
+    }
+
+    if (ya == yc) { // All on same line, span from leftmost to rightmost
+      a = b = xa;
+      if (xb < a)
+        a = xb;
+      else if (xb > b)
+        b = xb;
+      if (xc < a)
+        a = xc;
+      else if (xc > b)
+        b = xc;
+      hline(a, ya, b - a + 1, c);
+      return;
+    }
+
+    int16_t dxab = xb - xa, dyab = yb - ya, dxac = xc - xa, dyac = yc - ya,
+            dxbc = xc - xb, dybc = yc - yb;
+    int32_t sa = 0, sb = 0;
+
+    // Upper part: spans from edge a-b to edge a-c. Includes row yb if
+    // the lower part is flat (yb == yc), else that row is left to it.
+    last = (yb == yc) ? yb : yb - 1;
+    for (y = ya; y <= last; y++) {
+      a = xa + sa / dyab;
+      b = xa + sb / dyac;
+      sa += dxab;
+      sb += dxac;
+      if (a > b) {
+        t = a, a = b, b = t;
+      }
+      hline(a, y, b - a + 1, c);
+    }
+
+    // Lower part: spans from edge b-c to edge a-c
+    sa = (int32_t)dxbc * (y - yb);
+    sb = (int32_t)dxac * (y - ya);
+    for (; y <= yc; y++) {
+      a = xb + sa / dybc;
+      b = xa + sb / dyac;
+      sa += dxbc;
+      sb += dxac;
+      if (a > b) {
+        t = a, a = b, b = t;
+      }
+      hline(a, y, b - a + 1, c);
+    }
+  }
+
+  /**
+   * @brief  Draw one character in the Adafruit_GFX built-in 5x7 font.
+   * @param  x      Left edge.
+   * @param  y      Top edge.
+   * @param  ch     Character.
+   * @param  color  16-bit '565' text color.
+   * @param  bg     16-bit '565' background color, same as color for a
+   *                transparent background.
+   * @param  size   Magnification (1 = 6x8 pixel cell).
+   */
+  void drawChar(int16_t x, int16_t y, unsigned char ch, uint16_t color,
+                uint16_t bg, uint8_t size = 1) {
+    uint32_t fg32 = self().color(color), bg32 = self().color(bg);
+    bool opaque = (bg != color);
+    if (ch >= 176)
+      ch++; // Same glyph positions as Adafruit_GFX without cp437()
+    for (int8_t i = 0; i < 5; i++, x += size) {
+      uint8_t bits = pgm_read_byte(&dsMatrixFont[ch * 5 + i]);
+      int16_t yy = y;
+      for (int8_t j = 0; j < 8; j++, bits >>= 1, yy += size) {
+        if (bits & 1)
+          fill(x, yy, size, size, fg32);
+        else if (opaque)
+          fill(x, yy, size, size, bg32);
+      }
+    }
+    if (opaque) // Blank column between characters
+      fill(x, y, size, 8 * size, bg32);
+  }
+
+  /**
+   * @brief  Draw a string in the built-in font. '\\n' starts a new line
+   *         below the first character; there is no wrapping.
+   * @param  x      Left edge of first character.
+   * @param  y      Top edge of first character.
+   * @param  str    Null-terminated string.
+   * @param  color  16-bit '565' text color.
+   * @param  bg     16-bit '565' background color, same as color for a
+   *                transparent background.
+   * @param  size   Magnification (1 = 6x8 pixel cell).
+   * @return Column just past the last character drawn.
+   */
+  int16_t print(int16_t x, int16_t y, const char *str, uint16_t color,
+                uint16_t bg, uint8_t size = 1) {
+    int16_t left = x;
+    for (; *str; str++) {
+      if (*str == '\n') {
+        x = left;
+        y += 8 * size;
+      } else if (*str != '\r') {
+        drawChar(x, y, *str, color, bg, size);
+        x += 6 * size;
+      }
+    }
+    return x;
+  }
+
+protected:
+  /**
+   * @brief  Horizontal line in a 24-bit color.
+   * @param  x  Left end.
+   * @param  y  Row.
+   * @param  w  Length in pixels.
+   * @param  c  24-bit color.
+   */
+  void hline(int16_t x, int16_t y, int16_t w, uint32_t c) {
+    for (; w-- > 0; x++)
+      self().plot(x, y, c);
+  }
+
+  /**
+   * @brief  Vertical line in a 24-bit color.
+   * @param  x  Column.
+   * @param  y  Top end.
+   * @param  h  Length in pixels.
+   * @param  c  24-bit color.
+   */
+  void vline(int16_t x, int16_t y, int16_t h, uint32_t c) {
+    for (; h-- > 0; y++)
+      self().plot(x, y, c);
+  }
+
+  /**
+   * @brief  Filled rectangle in a 24-bit color.
+   * @param  x  Left edge.
+   * @param  y  Top edge.
+   * @param  w  Width.
+   * @param  h  Height.
+   * @param  c  24-bit color.
+   */
+  void fill(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t c) {
+    for (; h-- > 0; y++)
+      hline(x, y, w, c);
+  }
+
+  /**
+   * @brief  Bresenham line in a 24-bit color.
+   * @param  xa  Column of first point.
+   * @param  ya  Row of first point.
+   * @param  xb  Column of second point.
+   * @param  yb  Row of second point.
+   * @param  c   24-bit color.
+   */
+  void line(int16_t xa, int16_t ya, int16_t xb, int16_t yb, uint32_t c) {
+    int16_t t;
+    bool steep = abs(yb - ya) > abs(xb - xa);
+    if (steep) {
+      t = xa, xa = ya, ya = t;
+      t = xb, xb = yb, yb = t;
+    }
+    if (xa > xb) {
+      t = xa, xa = xb, xb = t;
+      t = ya, ya = yb, yb = t;
+    }
+    int16_t dx = xb - xa, dy = abs(yb - ya), err = dx / 2,
+            ystep = (ya < yb) ? 1 : -1;
+    for (; xa <= xb; xa++) {
+      if (steep)
+        self().plot(ya, xa, c);
+      else
+        self().plot(xa, ya, c);
+      err -= dy;
+      if (err < 0) {
+        ya += ystep;
+        err += dx;
+      }
+    }
+  }
+
+private:
+  Derived &self(void) { return *static_cast<Derived *>(this); }
+};
+
+/**
+ * @brief Statically dispatched drawing on an Adafruit_DotStarMatrix. Shapes
+ *        and text come from Adafruit_DotStarMatrixDraw; the pixel writer
+ *        here inlines into them. It works from a snapshot of the matrix's
+ *        rotation, viewport and layout: call sync() after changing any of
+ *        those. Drawing goes straight to the pixel buffer, skipping the
+ *        display list.
+ */
+class Adafruit_DotStarMatrixFast
+    : public Adafruit_DotStarMatrixDraw<Adafruit_DotStarMatrixFast> {
+
+public:
+  /**
+   * @brief  Construct a fast drawing front end for a matrix.
+   * @param  m  Matrix to draw on.
+   */
+  Adafruit_DotStarMatrixFast(Adafruit_DotStarMatrix &m);
+
+  /**
+   * @brief  Re-read rotation, viewport, scale, symmetry and layout from
+   *         the matrix, and flush its display list so earlier drawing
+   *         stays underneath.
+   */
+  void sync(void);
+
+  /**
+   * @brief  Write one pixel.
+   * @param  x  Column on the virtual canvas.
+   * @param  y  Row on the virtual canvas.
+   * @param  c  24-bit color, as-is (no gamma correction).
+   */
+  void plot(int16_t x, int16_t y, uint32_t c) {
+    if ((x < left) || (y < top) || (x >= right) || (y >= bottom))
+      return;
+    if (scaled) { // Let the matrix expand it into a block
+      matrix.drawRow(x, y, 1, NULL, &c, -1);
+      return;
+    }
+    x -= viewX;
+    y -= viewY;
+    int16_t t;
+    switch (rotation) {
+    case 1:
+      t = x;
+      x = physW - 1 - y;
+      y = t;
+      break;
+    case 2:
+      x = physW - 1 - x;
+      y = physH - 1 - y;
+      break;
+    case 3:
+      t = x;
+      x = y;
+      y = physH - 1 - t;
+      break;
+    }
+    if (mirrored)
+      matrix.writeXY(x, y, c);
+    else if (remapFn)
+      matrix.setPixelColor((*remapFn)(x, y), c);
+    else
+      matrix.setPixelColor(dsMatrixRemap(type, mW, mH, tX, tY, x, y), c);
+  }
+
+  /**
+   * @brief  Convert a 16-bit GFX color the way the matrix would, with
+   *         gamma correction or pass-through.
+   * @param  color  16-bit '565' color.
+   * @return 24-bit color.
+   */
+  uint32_t color(uint16_t color) const { return matrix.color32(color); }
+
+private:
+  Adafruit_DotStarMatrix &matrix;
+  int16_t left, top, right, bottom; // Drawable area, canvas coordinates
+  int16_t viewX, viewY;             // Canvas to screen offset
+  int16_t physW, physH;             // Unrotated size
+  uint8_t rotation, type, mW, mH, tX, tY;
+  uint16_t (*remapFn)(uint16_t x, uint16_t y);
+  bool scaled, mirrored;
+};
+
+#endif // _ADAFRUIT_DSMATRIX_FAST_H_
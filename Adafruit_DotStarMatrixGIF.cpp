@@ -0,0 +1,349 @@
+/*!
+ * @file Adafruit_DotStarMatrixGIF.cpp
+ *
+ * Streaming animated GIF player for Adafruit_DotStarMatrix.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <Adafruit_DotStarMatrixGIF.h>
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#elif defined(ESP8266)
+#include <pgmspace.h>
+#else
+#ifndef pgm_read_byte
+#define pgm_read_byte(addr)                                                    \
+  (*(const unsigned char *)(addr)) ///< PROGMEM concept doesn't apply here
+#endif
+#endif
+
+Adafruit_DotStarMatrixGIF::Adafruit_DotStarMatrixGIF(Adafruit_DotStarMatrix &m)
+    : matrix(m), stream(NULL), data(NULL), dataLen(0), dataPos(0),
+      firstFrame(0), eof(true), line(NULL), lineSize(0), nextTime(0) {}
+
+Adafruit_DotStarMatrixGIF::~Adafruit_DotStarMatrixGIF(void) { free(line); }
+
+bool Adafruit_DotStarMatrixGIF::begin(Stream &s, int16_t x, int16_t y) {
+  stream = &s;
+  data = NULL;
+  originX = x;
+  originY = y;
+  return readHeader();
+}
+
+bool Adafruit_DotStarMatrixGIF::begin(const uint8_t *d, uint32_t len,
+                                      int16_t x, int16_t y) {
+  stream = NULL;
+  data = d;
+  dataLen = len;
+  dataPos = 0;
+  originX = x;
+  originY = y;
+  if (!readHeader())
+    return false;
+  firstFrame = dataPos;
+  return true;
+}
+
+bool Adafruit_DotStarMatrixGIF::rewind(void) {
+  if (!data)
+    return false;
+  dataPos = firstFrame;
+  eof = false;
+  lastDisposal = 0;
+  return true;
+}
+
+uint16_t Adafruit_DotStarMatrixGIF::width(void) const { return screenWidth; }
+
+uint16_t Adafruit_DotStarMatrixGIF::height(void) const { return screenHeight; }
+
+// Read one byte from the current source. Past the end, returns 0 and
+// sets the eof flag, which callers check at convenient points rather
+// than after every byte.
+uint8_t Adafruit_DotStarMatrixGIF::readByte(void) {
+  if (!eof) {
+    if (data) {
+      if (dataPos < dataLen)
+        return pgm_read_byte(&data[dataPos++]);
+    } else {
+      int c = stream->read();
+      if (c >= 0)
+        return c;
+    }
+    eof = true;
+  }
+  return 0;
+}
+
+void Adafruit_DotStarMatrixGIF::readBytes(uint8_t *buf, uint16_t n) {
+  if (stream && !eof) {
+    if (stream->readBytes(buf, n) != n)
+      eof = true;
+  } else {
+    while (n--)
+      *buf++ = readByte();
+  }
+}
+
+// Skip a chain of data sub-blocks up to and including the terminator
+void Adafruit_DotStarMatrixGIF::skipBlocks(void) {
+  uint8_t n;
+  while ((n = readByte()) && !eof)
+    readBytes(block, n);
+}
+
+// Gamma-correct n raw RGB colors into the working palette
+void Adafruit_DotStarMatrixGIF::setPalette(const uint8_t *rgb,
+                                           uint16_t first, uint16_t n) {
+  for (uint16_t i = first; i < first + n; i++, rgb += 3)
+    palette[i] = Adafruit_DotStar::Color(Adafruit_DotStar::gamma8(rgb[0]),
+                                         Adafruit_DotStar::gamma8(rgb[1]),
+                                         Adafruit_DotStar::gamma8(rgb[2]));
+}
+
+bool Adafruit_DotStarMatrixGIF::readHeader(void) {
+  uint8_t hdr[13];
+
+  eof = false;
+  readBytes(hdr, 13); // Signature, version, logical screen descriptor
+  if (eof || memcmp(hdr, "GIF8", 4))
+    return false;
+
+  screenWidth = hdr[6] | (hdr[7] << 8);
+  screenHeight = hdr[8] | (hdr[9] << 8);
+  numGlobalColors = (hdr[10] & 0x80) ? (2 << (hdr[10] & 7)) : 0;
+  readBytes(globalColors, numGlobalColors * 3);
+
+  lastDisposal = 0;
+  nextTime = millis();
+  return !eof;
+}
+
+// Fetch the next variable-width LZW code from the data sub-blocks,
+// or -1 once the block chain ends.
+int16_t Adafruit_DotStarMatrixGIF::nextCode(void) {
+  while (bitCount < codeSize) {
+    if (blockPos >= blockLen) {
+      if (blocksDone || !(blockLen = readByte()) || eof) {
+        blocksDone = true;
+        return -1;
+      }
+      readBytes(block, blockLen);
+      blockPos = 0;
+    }
+    bitBuf |= (uint32_t)block[blockPos++] << bitCount;
+    bitCount += 8;
+  }
+  int16_t code = bitBuf & ((1 << codeSize) - 1);
+  bitBuf >>= codeSize;
+  bitCount -= codeSize;
+  return code;
+}
+
+// Add one decoded pixel to the scanline, issuing the line to the matrix
+// when complete.
+void Adafruit_DotStarMatrixGIF::putPixel(uint8_t i) {
+  if (row >= frameH)
+    return; // Excess data, ignore
+  uint16_t c = col - visStart;
+  if (c < visWidth)
+    line[c] = i;
+  if (++col < frameW)
+    return;
+
+  matrix.drawPaletteRow(originX + frameX + visStart, originY + frameY + row,
+                        line, visWidth, palette, transparent);
+  col = 0;
+  if (!pass) {
+    row++;
+  } else { // Interlaced: rows 0,8,16... then 4,12... then 2,6... then odd
+    static const uint8_t start[] = {0, 4, 2, 1}, step[] = {8, 8, 4, 2};
+    row += step[pass - 1];
+    while ((row >= frameH) && (pass < 4)) {
+      row = start[pass];
+      pass++;
+    }
+  }
+}
+
+int32_t Adafruit_DotStarMatrixGIF::drawFrame(void) {
+  frameDelay = 0;
+  transparent = -1;
+  disposal = 0;
+
+  while (!eof) {
+    uint8_t b = readByte();
+
+    if (b == 0x21) { // Extension
+      if (readByte() == 0xF9) { // Graphic control extension
+        uint8_t gce[5];
+        readBytes(gce, 5);
+        disposal = (gce[1] >> 2) & 7;
+        frameDelay = gce[2] | (gce[3] << 8);
+        if (gce[1] & 1)
+          transparent = gce[4];
+      }
+      skipBlocks();
+
+    } else if (b == 0x2C) { // Image descriptor
+      uint8_t desc[9];
+      readBytes(desc, 9);
+      frameX = desc[0] | (desc[1] << 8);
+      frameY = desc[2] | (desc[3] << 8);
+      frameW = desc[4] | (desc[5] << 8);
+      frameH = desc[6] | (desc[7] << 8);
+      pass = (desc[8] & 0x40) ? 1 : 0;
+      if (desc[8] & 0x80) { // Local color table, read in pieces
+        uint16_t n = 2 << (desc[8] & 7);
+        for (uint16_t i = 0; i < n; i += 64) {
+          uint16_t k = ((n - i) < 64) ? (n - i) : 64;
+          readBytes(block, k * 3);
+          setPalette(block, i, k);
+        }
+      } else {
+        setPalette(globalColors, 0, numGlobalColors);
+      }
+
+      // "Restore to background" from the previous frame. Background is
+      // treated as off. "Restore to previous" would need a copy of the
+      // prior frame, which is what this decoder avoids; it's handled as
+      // "leave in place."
+      if (lastDisposal == 2)
+        matrix.fillRect(originX + lastX, originY + lastY, lastW, lastH, 0);
+      lastDisposal = disposal;
+      lastX = frameX;
+      lastY = frameY;
+      lastW = frameW;
+      lastH = frameH;
+
+      // Only the columns that land on the screen are buffered (frames are
+      // placed in virtual canvas coordinates, as all drawing is)
+      int32_t left = (int32_t)originX + frameX,
+              screenLeft = matrix.getViewportX();
+      int32_t skip = (left < screenLeft) ? screenLeft - left : 0,
+              vis = screenLeft + matrix.width() - left;
+      if (vis > frameW)
+        vis = frameW;
+      vis -= skip;
+      visStart = (skip < frameW) ? skip : frameW;
+      visWidth = (vis > 0) ? vis : 0;
+      if (visWidth > lineSize) {
+        uint8_t *p = (uint8_t *)realloc(line, visWidth);
+        if (!p)
+          return -1;
+        line = p;
+        lineSize = visWidth;
+      }
+
+      uint8_t minCodeSize = readByte();
+      if ((minCodeSize < 2) || (minCodeSize > 11))
+        return -1;
+      uint16_t clear = 1 << minCodeSize, next = clear + 2;
+      int16_t code, old = -1;
+      uint8_t first = 0;
+      codeSize = minCodeSize + 1;
+      bitBuf = 0;
+      bitCount = blockLen = blockPos = 0;
+      blocksDone = false;
+      col = row = 0;
+      for (uint16_t i = 0; i < clear; i++)
+        suffix[i] = i;
+
+      while ((code = nextCode()) >= 0) {
+        if (code == clear) {
+          codeSize = minCodeSize + 1;
+          next = clear + 2;
+          old = -1;
+          continue;
+        }
+        if (code == clear + 1) // End of information
+          break;
+        if (old < 0) { // First code after a clear is always a root
+          if (code >= clear)
+            break; // Corrupt
+          first = code;
+          putPixel(first);
+          old = code;
+          continue;
+        }
+
+        // Unwind the string for this code onto the stack (reversed)
+        uint16_t sp = 0, in = code;
+        if (code >= next) { // Code not in table yet (KwKwK case)
+          stack[sp++] = first;
+          code = old;
+        }
+        while ((code >= clear) && (sp < DS_GIF_MAXCODE - 1)) {
+          stack[sp++] = suffix[code];
+          code = prefix[code];
+        }
+        first = code;
+        stack[sp++] = first;
+
+        if (next < DS_GIF_MAXCODE) {
+          prefix[next] = old;
+          suffix[next] = first;
+          if ((++next == (1u << codeSize)) && (codeSize < 12))
+            codeSize++;
+        }
+        old = in;
+
+        while (sp)
+          putPixel(stack[--sp]);
+      }
+      if (!blocksDone)
+        skipBlocks(); // Skip anything after end-of-information code
+
+      // Browsers treat very short delays as 1/10 sec; do the same so
+      // GIFs play back at the speed their authors saw.
+      return ((frameDelay < 2) ? 10 : frameDelay) * 10;
+
+    } else if (b == 0x3B) { // Trailer
+      break;
+    } else {
+      return -1; // Unknown block, bad data
+    }
+  }
+
+  return -1;
+}
+
+bool Adafruit_DotStarMatrixGIF::update(void) {
+  uint32_t now = millis();
+  if ((int32_t)(now - nextTime) < 0)
+    return false;
+
+  int32_t ms = drawFrame();
+  if ((ms < 0) && rewind())
+    ms = drawFrame();
+  if (ms < 0)
+    return false;
+
+  // Schedule from the previous deadline rather than 'now', so decode
+  // time doesn't accumulate as drift -- unless we've fallen far behind.
+  nextTime += ms;
+  if ((int32_t)(now - nextTime) > ms)
+    nextTime = now + ms;
+  return true;
+}
@@ -0,0 +1,160 @@
+/*!
+ * @file Adafruit_DotStarMatrixGIF.h
+ *
+ * Streaming animated GIF player for Adafruit_DotStarMatrix. Images are
+ * decoded one scanline at a time straight into the matrix's pixel buffer,
+ * so no full decoded frame is ever held in RAM.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef _ADAFRUIT_DSMATRIX_GIF_H_
+#define _ADAFRUIT_DSMATRIX_GIF_H_
+
+#include <Adafruit_DotStarMatrix.h>
+
+#define DS_GIF_MAXCODE 4096 ///< LZW dictionary size (12-bit codes)
+
+/**
+ * @brief Class for playing animated GIFs on an Adafruit_DotStarMatrix.
+ *        The LZW dictionary is a fixed ~16K table inside the object, so
+ *        this is intended for 32-bit boards, not AVR.
+ */
+class Adafruit_DotStarMatrixGIF {
+
+public:
+  /**
+   * @brief  Construct a GIF player bound to a matrix.
+   * @param  m  Matrix to draw on.
+   */
+  Adafruit_DotStarMatrixGIF(Adafruit_DotStarMatrix &m);
+  ~Adafruit_DotStarMatrixGIF(void);
+
+  /**
+   * @brief   Start playing a GIF read from a Stream (e.g. an SD card File
+   *          or Serial). Reads the GIF header and global color table.
+   * @param   s  Stream positioned at the start of the GIF data.
+   * @param   x  Matrix column for image's left edge.
+   * @param   y  Matrix row for image's top edge.
+   * @return  true on success, false if not a GIF.
+   */
+  bool begin(Stream &s, int16_t x = 0, int16_t y = 0);
+
+  /**
+   * @brief   Start playing a GIF held in flash (PROGMEM) memory. Reads the
+   *          GIF header and global color table.
+   * @param   data  Pointer to GIF data.
+   * @param   len   Size of GIF data in bytes.
+   * @param   x     Matrix column for image's left edge.
+   * @param   y     Matrix row for image's top edge.
+   * @return  true on success, false if not a GIF.
+   */
+  bool begin(const uint8_t *data, uint32_t len, int16_t x = 0,
+             int16_t y = 0);
+
+  /**
+   * @brief   Decode the next frame directly into the matrix pixel buffer.
+   *          Does not call show().
+   * @return  Time the frame should be displayed, in milliseconds, or -1
+   *          if there are no more frames (end of file or bad data).
+   */
+  int32_t drawFrame(void);
+
+  /**
+   * @brief   Return to the first frame. Only possible for GIFs in memory;
+   *          Stream sources must be reopened and passed to begin() again.
+   * @return  true on success, false if source can't be rewound.
+   */
+  bool rewind(void);
+
+  /**
+   * @brief   Non-blocking playback, call often from loop(). When the
+   *          current frame's delay has elapsed, draws the next frame
+   *          (looping back to the start of in-memory GIFs) and returns
+   *          true; the caller should then show() the matrix.
+   * @return  true if the matrix contents changed.
+   */
+  bool update(void);
+
+  /**
+   * @brief   Get GIF logical screen width.
+   * @return  Width in pixels.
+   */
+  uint16_t width(void) const;
+
+  /**
+   * @brief   Get GIF logical screen height.
+   * @return  Height in pixels.
+   */
+  uint16_t height(void) const;
+
+private:
+  bool readHeader(void);
+  uint8_t readByte(void);
+  void readBytes(uint8_t *buf, uint16_t n);
+  void skipBlocks(void);
+  void setPalette(const uint8_t *rgb, uint16_t first, uint16_t n);
+  int16_t nextCode(void);
+  void putPixel(uint8_t i);
+
+  Adafruit_DotStarMatrix &matrix;
+
+  // Data source: either a Stream or a block of flash memory
+  Stream *stream;
+  const uint8_t *data;
+  uint32_t dataLen, dataPos, firstFrame;
+  bool eof;
+
+  int16_t originX, originY;           // Image position on matrix
+  uint16_t screenWidth, screenHeight; // GIF logical screen size
+  uint8_t globalColors[256 * 3];      // Raw global color table
+  uint16_t numGlobalColors;
+  uint32_t palette[256]; // Gamma-corrected colors for frame
+
+  // Per-frame state from the graphic control extension and descriptor
+  uint16_t frameDelay;                     // In 1/100 sec
+  int16_t transparent;                     // Index or -1
+  uint8_t disposal, lastDisposal;          // GIF disposal methods
+  uint16_t frameX, frameY, frameW, frameH; // Frame rect in image
+  uint16_t lastX, lastY, lastW, lastH;     // Previous frame rect
+  uint16_t visStart, visWidth;             // Visible columns of frame
+  uint16_t col, row;                       // Decode position in frame
+  uint8_t pass;                            // Interlace pass (0 = none)
+
+  // Scanline buffer, sized to the visible part of a frame row
+  uint8_t *line;
+  uint16_t lineSize;
+
+  // LZW decoder state
+  uint8_t block[255]; // Current data sub-block
+  uint8_t blockLen, blockPos;
+  uint32_t bitBuf;
+  uint8_t bitCount, codeSize;
+  bool blocksDone;
+  uint16_t prefix[DS_GIF_MAXCODE];
+  uint8_t suffix[DS_GIF_MAXCODE];
+  uint8_t stack[DS_GIF_MAXCODE];
+
+  uint32_t nextTime; // millis() when update() draws the next frame
+};
+
+#endif // _ADAFRUIT_DSMATRIX_GIF_H_
@@ -0,0 +1,170 @@
+/*!
+ * @file Adafruit_DotStarMatrixLayout.h
+ *
+ * Matrix layout flags and the X/Y-to-pixel-index math behind them, kept
+ * free of Arduino dependencies so host-side tools (see extras/) can map
+ * pixels exactly the way the library does.
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef _ADAFRUIT_DSMATRIX_LAYOUT_H_
+#define _ADAFRUIT_DSMATRIX_LAYOUT_H_
+
+#include <stdint.h>
+
+// Matrix layout information is passed in the 'matrixType' parameter for
+// each constructor (the parameter immediately following is the LED type
+// from Adafruit_DotStar.h).
+
+// These define the layout for a single 'unified' matrix (e.g. one made
+// from DotStar strips), or for the pixels within each matrix of a tiled
+// display.
+
+#define DS_MATRIX_TOP 0x00         ///< Pixel 0 is at top of matrix
+#define DS_MATRIX_BOTTOM 0x01      ///< Pixel 0 is at bottom of matrix
+#define DS_MATRIX_LEFT 0x00        ///< Pixel 0 is at left of matrix
+#define DS_MATRIX_RIGHT 0x02       ///< Pixel 0 is at right of matrix
+#define DS_MATRIX_CORNER 0x03      ///< Bitmask for pixel 0 matrix corner
+#define DS_MATRIX_ROWS 0x00        ///< Matrix is row major (horizontal)
+#define DS_MATRIX_COLUMNS 0x04     ///< Matrix is column major (vertical)
+#define DS_MATRIX_AXIS 0x04        ///< Bitmask for row/column layout
+#define DS_MATRIX_PROGRESSIVE 0x00 ///< Same pixel order across each line
+#define DS_MATRIX_ZIGZAG 0x08      ///< Pixel order reverses between lines
+#define DS_MATRIX_SEQUENCE 0x08    ///< Bitmask for pixel line order
+
+// These apply only to tiled displays (multiple matrices):
+
+#define DS_TILE_TOP 0x00         ///< First tile is at top of matrix
+#define DS_TILE_BOTTOM 0x10      ///< First tile is at bottom of matrix
+#define DS_TILE_LEFT 0x00        ///< First tile is at left of matrix
+#define DS_TILE_RIGHT 0x20       ///< First tile is at right of matrix
+#define DS_TILE_CORNER 0x30      ///< Bitmask for first tile corner
+#define DS_TILE_ROWS 0x00        ///< Tiles ordered in rows
+#define DS_TILE_COLUMNS 0x40     ///< Tiles ordered in columns
+#define DS_TILE_AXIS 0x40        ///< Bitmask for tile H/V orientation
+#define DS_TILE_PROGRESSIVE 0x00 ///< Same tile order across each line
+#define DS_TILE_ZIGZAG 0x80      ///< Tile order reverses between lines
+#define DS_TILE_SEQUENCE 0x80    ///< Bitmask for tile line order
+
+#ifndef _swap_uint16_t
+#define _swap_uint16_t(a, b)                                                   \
+  {                                                                            \
+    uint16_t t = a;                                                            \
+    a = b;                                                                     \
+    b = t;                                                                     \
+  } ///< Swap contents of two uint16_t variables
+#endif
+
+/**
+ * @brief   Map unrotated X/Y coordinates to an absolute pixel index for a
+ *          single or tiled matrix described by DS_MATRIX_* and DS_TILE_*
+ *          flags.
+ * @param   type          Layout - DS_MATRIX_* and DS_TILE_* values added.
+ * @param   matrixWidth   Width of matrix (or of each tile) in pixels.
+ * @param   matrixHeight  Height of matrix (or of each tile) in pixels.
+ * @param   tilesX        Number of tiles across, or 0 if not tiled.
+ * @param   tilesY        Number of tiles down, or 0 if not tiled.
+ * @param   x             Pixel column, 0 to (total width - 1).
+ * @param   y             Pixel row, 0 to (total height - 1).
+ * @return  Pixel index along the strip.
+ */
+static inline uint16_t dsMatrixRemap(uint8_t type, uint8_t matrixWidth,
+                                     uint8_t matrixHeight, uint8_t tilesX,
+                                     uint8_t tilesY, uint16_t x, uint16_t y) {
+  uint16_t tileOffset = 0, pixelOffset;
+  uint8_t corner = type & DS_MATRIX_CORNER;
+  uint16_t minor, major, majorScale;
+
+  if (tilesX) { // Tiled display, multiple matrices
+    uint16_t tile;
+
+    minor = x / matrixWidth;           // Tile # X/Y; presume row major to
+    major = y / matrixHeight,          // start (will swap later if needed)
+        x = x - (minor * matrixWidth); // Pixel X/Y within tile
+    y = y - (major * matrixHeight);    // (-* is less math than modulo)
+
+    // Determine corner of entry, flip axes if needed
+    if (type & DS_TILE_RIGHT)
+      minor = tilesX - 1 - minor;
+    if (type & DS_TILE_BOTTOM)
+      major = tilesY - 1 - major;
+
+    // Determine actual major axis of tiling
+    if ((type & DS_TILE_AXIS) == DS_TILE_ROWS) {
+      majorScale = tilesX;
+    } else {
+      _swap_uint16_t(major, minor);
+      majorScale = tilesY;
+    }
+
+    // Determine tile number
+    if ((type & DS_TILE_SEQUENCE) == DS_TILE_PROGRESSIVE) {
+      // All tiles in same order
+      tile = major * majorScale + minor;
+    } else {
+      // Zigzag; alternate rows change direction.  On these rows,
+      // this also flips the starting corner of the matrix for the
+      // pixel math later.
+      if (major & 1) {
+        corner ^= DS_MATRIX_CORNER;
+        tile = (major + 1) * majorScale - 1 - minor;
+      } else {
+        tile = major * majorScale + minor;
+      }
+    }
+
+    // Index of first pixel in tile
+    tileOffset = tile * matrixWidth * matrixHeight;
+
+  } // else no tiling (handle as single tile)
+
+  // Find pixel number within tile
+  minor = x; // Presume row major to start (will swap later if needed)
+  major = y;
+
+  // Determine corner of entry, flip axes if needed
+  if (corner & DS_MATRIX_RIGHT)
+    minor = matrixWidth - 1 - minor;
+  if (corner & DS_MATRIX_BOTTOM)
+    major = matrixHeight - 1 - major;
+
+  // Determine actual major axis of matrix
+  if ((type & DS_MATRIX_AXIS) == DS_MATRIX_ROWS) {
+    majorScale = matrixWidth;
+  } else {
+    _swap_uint16_t(major, minor);
+    majorScale = matrixHeight;
+  }
+
+  // Determine pixel number within tile/matrix
+  if ((type & DS_MATRIX_SEQUENCE) == DS_MATRIX_PROGRESSIVE) {
+    // All lines in same order
+    pixelOffset = major * majorScale + minor;
+  } else {
+    // Zigzag; alternate rows change direction.
+    if (major & 1)
+      pixelOffset = (major + 1) * majorScale - 1 - minor;
+    else
+      pixelOffset = major * majorScale + minor;
+  }
+
+  return tileOffset + pixelOffset;
+}
+
+#endif // _ADAFRUIT_DSMATRIX_LAYOUT_H_
@@ -0,0 +1,247 @@
+/*!
+ * @file Adafruit_DotStarMatrixLife.cpp
+ *
+ * Bit-packed Life-like cellular automata for Adafruit_DotStarMatrix.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <Adafruit_DotStarMatrixLife.h>
+
+// Cell x of a row is bit (x & 31) of word (x >> 5).
+
+Adafruit_DotStarMatrixLife::Adafruit_DotStarMatrixLife(
+    Adafruit_DotStarMatrix &m)
+    : matrix(m) {}
+
+Adafruit_DotStarMatrixLife::~Adafruit_DotStarMatrixLife(void) {
+  free(buffer);
+}
+
+bool Adafruit_DotStarMatrixLife::begin(uint16_t w, uint16_t h, int16_t x,
+                                       int16_t y) {
+  free(buffer);
+  cells = previous = buffer = NULL;
+  width = w ? w : matrix.width();
+  height = h ? h : matrix.height();
+  rowWords = (width + 31) / 32;
+  originX = x;
+  originY = y;
+  generation = 0;
+  drawn = false;
+  uint32_t n = (uint32_t)rowWords * height;
+  if (!n || !(buffer = (uint32_t *)calloc(2 * n + rowWords, 4)))
+    return false;
+  cells = buffer;
+  previous = buffer + n;
+  return true;
+}
+
+void Adafruit_DotStarMatrixLife::setRule(uint16_t b, uint16_t s) {
+  birth = b;
+  survive = s;
+}
+
+void Adafruit_DotStarMatrixLife::setColors(uint16_t alive, uint16_t dead) {
+  aliveColor = alive;
+  deadColor = dead;
+}
+
+void Adafruit_DotStarMatrixLife::setCell(int16_t x, int16_t y, bool alive) {
+  if (!cells || (x < 0) || (y < 0) || (x >= width) || (y >= height))
+    return;
+  uint32_t *w = &cells[y * rowWords + (x >> 5)], bit = 1UL << (x & 31);
+  if (alive)
+    *w |= bit;
+  else
+    *w &= ~bit;
+  drawn = false; // Not just a change from the previous generation now
+}
+
+bool Adafruit_DotStarMatrixLife::getCell(int16_t x, int16_t y) const {
+  if (!cells || (x < 0) || (y < 0) || (x >= width) || (y >= height))
+    return false;
+  return (cells[y * rowWords + (x >> 5)] >> (x & 31)) & 1;
+}
+
+void Adafruit_DotStarMatrixLife::clear(void) {
+  if (cells)
+    memset(cells, 0, (uint32_t)rowWords * height * 4);
+  drawn = false;
+}
+
+void Adafruit_DotStarMatrixLife::randomize(uint8_t percent) {
+  clear();
+  for (int16_t y = 0; y < height; y++) {
+    for (int16_t x = 0; x < width; x++) {
+      if (random(100) < percent)
+        setCell(x, y);
+    }
+  }
+}
+
+uint32_t Adafruit_DotStarMatrixLife::population(void) const {
+  uint32_t n = 0, words = (uint32_t)rowWords * height;
+  for (uint32_t i = 0; i < (cells ? words : 0); i++)
+    n += __builtin_popcountl(cells[i]);
+  return n;
+}
+
+// Add three bits in each of 32 positions at once
+static inline void add3(uint32_t a, uint32_t b, uint32_t c, uint32_t &sum,
+                        uint32_t &carry) {
+  uint32_t t = a ^ b;
+  sum = t ^ c;
+  carry = (a & b) | (t & c);
+}
+
+// Each cell's left (x - 1) and right (x + 1) neighbors in word k of a row,
+// lined up with it. Off either end is the other end if wrapping, else
+// nothing. (The last word's left neighbors include one past the edge,
+// from cell width - 1; the caller masks it off.)
+static inline void sideways(const uint32_t *row, uint16_t k, uint16_t words,
+                            uint16_t width, bool wrap, uint32_t &left,
+                            uint32_t &right) {
+  uint32_t w = row[k], in;
+  if (k)
+    in = row[k - 1] >> 31;
+  else
+    in = wrap ? (row[words - 1] >> ((width - 1) & 31)) & 1 : 0;
+  left = (w << 1) | in;
+  if ((k + 1) < words)
+    right = (w >> 1) | (row[k + 1] << 31);
+  else
+    right = (w >> 1) | ((wrap ? row[0] & 1 : 0) << ((width - 1) & 31));
+}
+
+// For each word, the eight neighbor words (rows above and below, each
+// shifted both ways, and this row shifted) go through an adder tree that
+// leaves every cell's neighbor count in four bit planes. The rule then
+// picks out the counts that give a live cell, still 32 cells at a time.
+void Adafruit_DotStarMatrixLife::step(void) {
+  if (!cells)
+    return;
+  const uint32_t *zero = buffer + 2 * (uint32_t)rowWords * height;
+  uint32_t lastMask = (width & 31) ? (1UL << (width & 31)) - 1 : ~0UL;
+  uint16_t counts = birth | survive;
+  uint32_t *out = previous;
+
+  for (uint16_t y = 0; y < height; y++) {
+    const uint32_t *above = y ? &cells[(y - 1) * rowWords]
+                              : wrap ? &cells[(height - 1) * rowWords] : zero,
+                   *here = &cells[y * rowWords],
+                   *below = ((y + 1) < height) ? here + rowWords
+                            : wrap             ? cells
+                                               : zero;
+    for (uint16_t k = 0; k < rowWords; k++) {
+      uint32_t al, ar, hl, hr, bl, br;
+      sideways(above, k, rowWords, width, wrap, al, ar);
+      sideways(here, k, rowWords, width, wrap, hl, hr);
+      sideways(below, k, rowWords, width, wrap, bl, br);
+
+      uint32_t sa, ca, sb, cb, s0, c0, t1, c1, s1, c2, s2, s3;
+      add3(al, above[k], ar, sa, ca); // Row above: 0-3
+      add3(bl, below[k], br, sb, cb); // Row below: 0-3
+      add3(sa, sb, hl ^ hr, s0, c0);  // Ones
+      add3(ca, cb, hl & hr, t1, c1);  // Twos (but for c0)...
+      s1 = t1 ^ c0;                   // ...now with it
+      c2 = t1 & c0;
+      s2 = c1 ^ c2; // Fours
+      s3 = c1 & c2; // Eights
+
+      uint32_t live = here[k], next = 0;
+      for (uint8_t n = 0; n <= 8; n++) {
+        if (!(counts & (1 << n)))
+          continue;
+        uint32_t is = ((n & 1) ? s0 : ~s0) & ((n & 2) ? s1 : ~s1) &
+                      ((n & 4) ? s2 : ~s2) & ((n & 8) ? s3 : ~s3);
+        if (!(birth & (1 << n)))
+          is &= live; // Survival only
+        else if (!(survive & (1 << n)))
+          is &= ~live; // Birth only
+        next |= is;
+      }
+      if ((k + 1) == rowWords)
+        next &= lastMask; // Keep bits past the edge clear
+      *out++ = next;
+    }
+  }
+
+  previous = cells;
+  cells = out - (uint32_t)rowWords * height;
+  generation++;
+}
+
+// Draw one row's runs of live (or dead) cells, either all of them or just
+// those that changed since the previous generation. Runs are found a word
+// at a time by counting trailing zeros, and may carry on across words.
+void Adafruit_DotStarMatrixLife::drawRuns(int16_t y, bool alive,
+                                          bool changes) {
+  const uint32_t *now = &cells[y * rowWords], *was = &previous[y * rowWords];
+  uint32_t lastMask = (width & 31) ? (1UL << (width & 31)) - 1 : ~0UL;
+  uint16_t color = alive ? aliveColor : deadColor;
+  int16_t start = -1; // Start of run in progress, or -1 if none
+
+  for (uint16_t k = 0; k < rowWords; k++) {
+    uint32_t m = alive ? now[k] : ~now[k];
+    if (changes)
+      m &= now[k] ^ was[k];
+    if ((k + 1) == rowWords)
+      m &= lastMask;
+    uint8_t pos = 0;
+    while (pos < 32) {
+      if (start < 0) { // Find next run start
+        uint32_t rest = m >> pos;
+        if (!rest)
+          break;
+        pos += __builtin_ctzl(rest);
+        start = k * 32 + pos;
+      }
+      uint32_t rest = ~m >> pos; // Find its end
+      if (!rest)
+        break; // Continues into next word
+      pos += __builtin_ctzl(rest);
+      matrix.drawFastHLine(originX + start, originY + y, k * 32 + pos - start,
+                           color);
+      start = -1;
+    }
+  }
+  if (start >= 0)
+    matrix.drawFastHLine(originX + start, originY + y, width - start, color);
+}
+
+void Adafruit_DotStarMatrixLife::draw(bool all) {
+  if (!cells)
+    return;
+  bool changes = false;
+  if (!all && drawn) {
+    if (drawnGeneration == generation)
+      return; // Already there
+    changes = (drawnGeneration + 1) == generation;
+  }
+  for (int16_t y = 0; y < height; y++) {
+    drawRuns(y, true, changes);
+    drawRuns(y, false, changes);
+  }
+  drawnGeneration = generation;
+  drawn = true;
+}
@@ -0,0 +1,168 @@
+/*!
+ * @file Adafruit_DotStarMatrixLife.h
+ *
+ * Life-like cellular automata (Conway's Game of Life, HighLife, Seeds and
+ * so on) for Adafruit_DotStarMatrix. Cells are stored as bits, 32 to a
+ * word, and a whole word of cells is stepped at once with bitwise logic,
+ * so even large walls can run a generation every frame.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef _ADAFRUIT_DSMATRIX_LIFE_H_
+#define _ADAFRUIT_DSMATRIX_LIFE_H_
+
+#include <Adafruit_DotStarMatrix.h>
+
+// Rules for setRule(): bit n set if a cell is born (or survives) with n
+// live neighbors
+
+#define DS_LIFE_B(n) (1 << (n)) ///< Birth/survival mask bit for n neighbors
+
+#define DS_LIFE_CONWAY DS_LIFE_B(3), DS_LIFE_B(2) | DS_LIFE_B(3) ///< B3/S23
+#define DS_LIFE_HIGHLIFE                                                       \
+  DS_LIFE_B(3) | DS_LIFE_B(6), DS_LIFE_B(2) | DS_LIFE_B(3) ///< B36/S23
+#define DS_LIFE_SEEDS DS_LIFE_B(2), 0                      ///< B2/S
+#define DS_LIFE_DAYNIGHT                                                       \
+  DS_LIFE_B(3) | DS_LIFE_B(6) | DS_LIFE_B(7) | DS_LIFE_B(8),                   \
+      DS_LIFE_B(3) | DS_LIFE_B(4) | DS_LIFE_B(6) | DS_LIFE_B(7) |              \
+          DS_LIFE_B(8) ///< B3678/S34678
+
+/**
+ * @brief Class for running a Life-like cellular automaton on a matrix.
+ */
+class Adafruit_DotStarMatrixLife {
+
+public:
+  /**
+   * @brief  Construct an automaton bound to a matrix. Call begin() before
+   *         use.
+   * @param  m  Matrix to draw on.
+   */
+  Adafruit_DotStarMatrixLife(Adafruit_DotStarMatrix &m);
+  ~Adafruit_DotStarMatrixLife(void);
+
+  /**
+   * @brief   Allocate the cell grid (two bits per cell), all cells dead.
+   *          Rule is Conway's Life, edges wrap around.
+   * @param   w  Grid width in cells, or 0 for the matrix width.
+   * @param   h  Grid height in cells, or 0 for the matrix height.
+   * @param   x  Matrix column for grid's left edge.
+   * @param   y  Matrix row for grid's top edge.
+   * @return  true on success, false if out of memory.
+   */
+  bool begin(uint16_t w = 0, uint16_t h = 0, int16_t x = 0, int16_t y = 0);
+
+  /**
+   * @brief  Set the birth and survival rule, e.g. setRule(DS_LIFE_CONWAY).
+   * @param  birth    Bit n set if a dead cell with n live neighbors comes
+   *                  to life.
+   * @param  survive  Bit n set if a live cell with n live neighbors stays
+   *                  alive.
+   */
+  void setRule(uint16_t birth, uint16_t survive);
+
+  /**
+   * @brief  Set whether the grid wraps around at its edges (a torus), or
+   *         cells beyond the edges are always dead.
+   * @param  w  true to wrap (default), false for dead edges.
+   */
+  void setWrap(bool w) { wrap = w; }
+
+  /**
+   * @brief  Set colors for live and dead cells. Takes effect for cells
+   *         drawn from here on; call draw(true) to repaint them all.
+   * @param  alive  16-bit '565' RGB color for live cells.
+   * @param  dead   16-bit '565' RGB color for dead cells.
+   */
+  void setColors(uint16_t alive, uint16_t dead = 0);
+
+  /**
+   * @brief  Set one cell alive or dead.
+   * @param  x  Cell column.
+   * @param  y  Cell row.
+   * @param  alive  true for alive.
+   */
+  void setCell(int16_t x, int16_t y, bool alive = true);
+
+  /**
+   * @brief   Get one cell's state.
+   * @param   x  Cell column.
+   * @param   y  Cell row.
+   * @return  true if alive, false if dead or outside the grid.
+   */
+  bool getCell(int16_t x, int16_t y) const;
+
+  /**
+   * @brief  Kill all cells.
+   */
+  void clear(void);
+
+  /**
+   * @brief  Fill the grid with random cells, using random().
+   * @param  percent  Chance of each cell being alive, 0-100.
+   */
+  void randomize(uint8_t percent = 33);
+
+  /**
+   * @brief  Advance one generation. Doesn't draw anything.
+   */
+  void step(void);
+
+  /**
+   * @brief  Draw the grid on the matrix as horizontal runs of live and
+   *         dead cells. If the matrix last showed the previous generation,
+   *         only cells that changed since are drawn. Does not call show().
+   * @param  all  true to draw every cell regardless.
+   */
+  void draw(bool all = false);
+
+  /**
+   * @brief   Count live cells.
+   * @return  uint32_t  Population.
+   */
+  uint32_t population(void) const;
+
+  /**
+   * @brief   Get number of generations stepped since begin().
+   * @return  uint32_t  Generation count.
+   */
+  uint32_t getGeneration(void) const { return generation; }
+
+private:
+  void drawRuns(int16_t y, bool alive, bool changes);
+
+  Adafruit_DotStarMatrix &matrix;
+  uint32_t *buffer = NULL;   // Both generations, then a row of zeros
+  uint32_t *cells = NULL;    // Current generation, rowWords per row
+  uint32_t *previous = NULL; // Generation before, for drawing changes
+  uint16_t width = 0, height = 0, rowWords = 0;
+  int16_t originX = 0, originY = 0; // Grid position on matrix
+  uint16_t birth = DS_LIFE_B(3), survive = DS_LIFE_B(2) | DS_LIFE_B(3);
+  bool wrap = true;
+  uint16_t aliveColor = 0xFFFF, deadColor = 0;
+  uint32_t generation = 0;
+  uint32_t drawnGeneration = 0; // Generation on the matrix...
+  bool drawn = false;           // ...if this is set
+};
+
+#endif // _ADAFRUIT_DSMATRIX_LIFE_H_
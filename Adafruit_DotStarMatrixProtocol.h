@@ -0,0 +1,64 @@
+/*!
+ * @file Adafruit_DotStarMatrixProtocol.h
+ *
+ * Binary drawing command protocol for driving a matrix remotely, e.g.
+ * from a PC over USB serial. Shared by the device-side parser
+ * (Adafruit_DotStarMatrixRemote) and the host-side encoder in extras/,
+ * so it has no Arduino dependencies.
+ *
+ * Each command is a one-byte opcode followed by fixed arguments; TEXT
+ * and BITMAP are then followed by a payload whose length the arguments
+ * determine. Coordinates and sizes are signed 16-bit, colors are 16-bit
+ * '565' RGB, both little-endian. There is no framing or checksum:
+ * unknown opcodes are skipped a byte at a time.
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef _ADAFRUIT_DSMATRIX_PROTOCOL_H_
+#define _ADAFRUIT_DSMATRIX_PROTOCOL_H_
+
+// Opcodes and their arguments, in order:
+
+#define DSR_FILL_RECT 0x01   ///< x, y, w, h, color
+#define DSR_HLINE 0x02       ///< x, y, w, color
+#define DSR_VLINE 0x03       ///< x, y, h, color
+#define DSR_PIXEL 0x04       ///< x, y, color
+#define DSR_FILL_SCREEN 0x05 ///< color
+#define DSR_TEXT 0x06        ///< x, y, color, bg, size (8 bit), len (8 bit)
+#define DSR_BITMAP 0x07      ///< x, y, w, h, color, bg
+#define DSR_SCROLL 0x08      ///< x, y, w, h, dx, dy, color
+#define DSR_SHOW 0x09        ///< No arguments
+#define DSR_BRIGHTNESS 0x0A  ///< brightness (8 bit)
+#define DSR_ROTATION 0x0B    ///< rotation (8 bit)
+#define DSR_NUM_OPS 0x0C     ///< One past highest opcode
+
+// DSR_TEXT is followed by 'len' characters, drawn with the GFX font and
+// cursor/wrap rules. DSR_BITMAP is followed by h rows of (w + 7) / 8
+// bytes, 1 bit per pixel, MSB first (same as Adafruit_GFX drawBitmap()).
+// For both, bg == color means a transparent background.
+
+#define DSR_MAX_ARGS 14 ///< Longest argument list in bytes (DSR_SCROLL)
+
+/**
+ * @brief  Argument bytes following each opcode (0 for unused opcodes).
+ */
+#define DSR_ARG_BYTES                                                          \
+  { 0, 10, 8, 8, 6, 2, 10, 12, 14, 0, 1, 1 }
+
+#endif // _ADAFRUIT_DSMATRIX_PROTOCOL_H_
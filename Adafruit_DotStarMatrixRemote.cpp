@@ -0,0 +1,157 @@
+/*!
+ * @file Adafruit_DotStarMatrixRemote.cpp
+ *
+ * Streaming parser for the DotStarMatrix binary drawing protocol.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <Adafruit_DotStarMatrixRemote.h>
+
+static const uint8_t argBytes[DSR_NUM_OPS] = DSR_ARG_BYTES;
+
+Adafruit_DotStarMatrixRemote::Adafruit_DotStarMatrixRemote(
+    Adafruit_DotStarMatrix &m)
+    : matrix(m), op(0), payload(0) {}
+
+void Adafruit_DotStarMatrixRemote::process(Stream &s) {
+  int n = s.available();
+  while (n-- > 0)
+    process((uint8_t)s.read());
+}
+
+// Little-endian signed 16-bit argument starting at byte i
+int16_t Adafruit_DotStarMatrixRemote::arg16(uint8_t i) const {
+  return (int16_t)(args[i] | (args[i + 1] << 8));
+}
+
+void Adafruit_DotStarMatrixRemote::process(uint8_t b) {
+  if (!op) { // Start of new command
+    if ((b >= DSR_NUM_OPS) || (!argBytes[b] && (b != DSR_SHOW)))
+      return; // Unknown opcode, skip
+    op = b;
+    argLen = argBytes[b];
+    argPos = 0;
+    if (!argLen)
+      execute();
+    return;
+  }
+
+  if (argPos < argLen) { // Collecting arguments
+    args[argPos++] = b;
+    if (argPos == argLen)
+      execute();
+    return;
+  }
+
+  // Payload byte for TEXT or BITMAP
+  if (op == DSR_TEXT) {
+    matrix.write(b);
+  } else { // DSR_BITMAP
+    if (rowPos < DSR_MAX_ROW)
+      row[rowPos] = b;
+    if (++rowPos >= rowBytes) {
+      drawRow();
+      rowPos = 0;
+      rowY++;
+    }
+  }
+  if (!--payload)
+    op = 0;
+}
+
+// Run a command whose arguments are complete. Commands with a payload
+// set up for it and leave 'op' set until it has all been received.
+void Adafruit_DotStarMatrixRemote::execute(void) {
+  uint8_t o = op;
+  op = 0;
+
+  switch (o) {
+  case DSR_FILL_RECT:
+    matrix.fillRect(arg16(0), arg16(2), arg16(4), arg16(6), arg16(8));
+    break;
+  case DSR_HLINE:
+    matrix.drawFastHLine(arg16(0), arg16(2), arg16(4), arg16(6));
+    break;
+  case DSR_VLINE:
+    matrix.drawFastVLine(arg16(0), arg16(2), arg16(4), arg16(6));
+    break;
+  case DSR_PIXEL:
+    matrix.drawPixel(arg16(0), arg16(2), arg16(4));
+    break;
+  case DSR_FILL_SCREEN:
+    matrix.fillScreen(arg16(0));
+    break;
+  case DSR_TEXT:
+    matrix.setCursor(arg16(0), arg16(2));
+    matrix.setTextColor(arg16(4), arg16(6));
+    matrix.setTextSize(args[8] ? args[8] : 1);
+    if ((payload = args[9]))
+      op = o;
+    break;
+  case DSR_BITMAP:
+    rowBytes = (arg16(4) + 7) / 8;
+    rowPos = 0;
+    rowY = arg16(2);
+    if ((arg16(4) > 0) && (arg16(6) > 0)) {
+      payload = (uint32_t)rowBytes * arg16(6);
+      op = o;
+    }
+    break;
+  case DSR_SCROLL:
+    matrix.scrollRect(arg16(0), arg16(2), arg16(4), arg16(6), arg16(8),
+                      arg16(10), arg16(12));
+    break;
+  case DSR_SHOW:
+    matrix.show();
+    break;
+  case DSR_BRIGHTNESS:
+    matrix.setBrightness(args[0]);
+    break;
+  case DSR_ROTATION:
+    matrix.setRotation(args[0]);
+    break;
+  }
+}
+
+// Draw one received BITMAP row as runs of foreground (and background,
+// if opaque) color, so each run is a single line fill on the matrix.
+void Adafruit_DotStarMatrixRemote::drawRow(void) {
+  int16_t x = arg16(0), w = arg16(4);
+  uint16_t color = arg16(8), bg = arg16(10);
+  if (w > DSR_MAX_ROW * 8)
+    w = DSR_MAX_ROW * 8;
+
+  int16_t start = 0;
+  bool on = row[0] & 0x80;
+  for (int16_t i = 1; i <= w; i++) {
+    bool bit = (i < w) && (row[i >> 3] & (0x80 >> (i & 7)));
+    if ((i == w) || (bit != on)) { // End of run
+      if (on)
+        matrix.drawFastHLine(x + start, rowY, i - start, color);
+      else if (bg != color)
+        matrix.drawFastHLine(x + start, rowY, i - start, bg);
+      start = i;
+      on = bit;
+    }
+  }
+}
@@ -0,0 +1,81 @@
+/*!
+ * @file Adafruit_DotStarMatrixRemote.h
+ *
+ * Streaming parser for the binary drawing protocol defined in
+ * Adafruit_DotStarMatrixProtocol.h. Commands are dispatched to the
+ * matrix's drawing functions as they arrive, so a host can drive a large
+ * display over serial with far fewer bytes than sending whole frames.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * This file is part of the Adafruit DotStarMatrix library.
+ *
+ * DotStarMatrix is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DotStarMatrix is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with DotStarMatrix.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef _ADAFRUIT_DSMATRIX_REMOTE_H_
+#define _ADAFRUIT_DSMATRIX_REMOTE_H_
+
+#include <Adafruit_DotStarMatrix.h>
+#include <Adafruit_DotStarMatrixProtocol.h>
+
+#define DSR_MAX_ROW 64 ///< Bitmap row buffer; rows up to 512 px are drawn
+
+/**
+ * @brief Class for executing remote drawing commands on a matrix.
+ */
+class Adafruit_DotStarMatrixRemote {
+
+public:
+  /**
+   * @brief  Construct a command parser bound to a matrix.
+   * @param  m  Matrix to draw on.
+   */
+  Adafruit_DotStarMatrixRemote(Adafruit_DotStarMatrix &m);
+
+  /**
+   * @brief  Read and execute whatever command bytes are available from a
+   *         Stream (e.g. Serial), without waiting for more. Call often
+   *         from loop(); commands may span any number of calls.
+   * @param  s  Stream to read from.
+   */
+  void process(Stream &s);
+
+  /**
+   * @brief  Feed one byte of the command stream, executing a command
+   *         once it's complete.
+   * @param  b  Next byte.
+   */
+  void process(uint8_t b);
+
+private:
+  void execute(void);
+  void drawRow(void);
+  int16_t arg16(uint8_t i) const;
+
+  Adafruit_DotStarMatrix &matrix;
+  uint8_t op;                 // Current opcode, 0 if awaiting one
+  uint8_t args[DSR_MAX_ARGS]; // Argument bytes received
+  uint8_t argLen, argPos;     // Argument length, bytes received so far
+  uint32_t payload;           // TEXT/BITMAP bytes remaining
+  uint8_t row[DSR_MAX_ROW];   // Current BITMAP row
+  uint16_t rowBytes, rowPos;  // BITMAP bytes per row, received so far
+  int16_t rowY;               // Y of current BITMAP row
+};
+
+#endif // _ADAFRUIT_DSMATRIX_REMOTE_H_
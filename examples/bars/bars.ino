@@ -0,0 +1,41 @@
+// Adafruit_DotStarMatrix example: spectrum-style bar graph with falling
+// peak markers. Bars here just wander randomly; in a real visualizer the
+// heights would come from an FFT of audio input. Only cells that change
+// are redrawn each frame.
+
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_DotStarMatrix.h>
+#include <Adafruit_DotStarMatrixBars.h>
+#include <Adafruit_DotStar.h>
+
+#define DATAPIN  4
+#define CLOCKPIN 5
+#define NUM_BARS 6
+
+Adafruit_DotStarMatrix matrix = Adafruit_DotStarMatrix(
+  12, 6, DATAPIN, CLOCKPIN,
+  DS_MATRIX_BOTTOM     + DS_MATRIX_LEFT +
+  DS_MATRIX_ROWS + DS_MATRIX_ZIGZAG,
+  DOTSTAR_BGR);
+
+Adafruit_DotStarMatrixBars bars(matrix);
+
+uint8_t heights[NUM_BARS];
+
+void setup() {
+  matrix.begin();
+  matrix.setBrightness(40);
+  bars.setColors(matrix.Color(0, 255, 0), 0, matrix.Color(255, 0, 0));
+  bars.setPeakHold(8);
+}
+
+void loop() {
+  for (uint8_t i = 0; i < NUM_BARS; i++) {
+    int16_t h = heights[i] + random(-60, 61);
+    heights[i] = (h < 0) ? 0 : (h > 255) ? 255 : h;
+  }
+  bars.drawBars(heights, NUM_BARS, DS_BARS_PEAK | DS_BARS_GAP);
+  matrix.show();
+  delay(50);
+}
@@ -0,0 +1,36 @@
+// Adafruit_DotStarMatrix example: scrolling strip chart. Plots a reading
+// (here, analog input A0) every 100 ms. Each sample scrolls the chart a
+// column left within the pixel buffer and draws only the new column.
+
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_DotStarMatrix.h>
+#include <Adafruit_DotStarMatrixChart.h>
+#include <Adafruit_DotStar.h>
+
+#define DATAPIN  4
+#define CLOCKPIN 5
+
+Adafruit_DotStarMatrix matrix = Adafruit_DotStarMatrix(
+  12, 6, DATAPIN, CLOCKPIN,
+  DS_MATRIX_BOTTOM     + DS_MATRIX_LEFT +
+  DS_MATRIX_ROWS + DS_MATRIX_ZIGZAG,
+  DOTSTAR_BGR);
+
+Adafruit_DotStarMatrixChart chart(matrix);
+
+void setup() {
+  matrix.begin();
+  matrix.setBrightness(40);
+  if (!chart.begin()) // Whole screen
+    for(;;);
+  chart.setRange(0, 1023);
+  chart.setColors(matrix.Color(0, 255, 64), matrix.Color(0, 0, 24));
+  chart.setStyle(DS_CHART_LINE);
+}
+
+void loop() {
+  chart.addSample(analogRead(A0));
+  matrix.show();
+  delay(100);
+}
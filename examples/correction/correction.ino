@@ -0,0 +1,62 @@
+// Adafruit_DotStarMatrix example: per-LED uniformity correction. A
+// correction map holds a gain for each color channel of each LED, in
+// strip order, and is applied as the pixel buffer is issued to the LEDs.
+// In an installation, measure each LED and store the map on an SD card,
+// then load it with matrix.loadCorrectionMap(file). Here a synthetic
+// map stands in for a measured one.
+// The cost of correction per frame is printed to the Serial console.
+
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_DotStarMatrix.h>
+#include <Adafruit_DotStar.h>
+
+#define DATAPIN  4
+#define CLOCKPIN 5
+#define MATRIX_W 12
+#define MATRIX_H  6
+
+Adafruit_DotStarMatrix matrix = Adafruit_DotStarMatrix(
+  MATRIX_W, MATRIX_H, DATAPIN, CLOCKPIN,
+  DS_MATRIX_BOTTOM     + DS_MATRIX_LEFT +
+  DS_MATRIX_ROWS + DS_MATRIX_PROGRESSIVE,
+  DOTSTAR_BGR);
+
+uint8_t gains[MATRIX_W * MATRIX_H * 3];
+
+// Microseconds per show(), averaged
+uint32_t timeShow(void) {
+  uint32_t t = micros();
+  for (uint8_t i = 0; i < 100; i++) matrix.show();
+  return (micros() - t) / 100;
+}
+
+void setup() {
+  Serial.begin(115200);
+  matrix.begin();
+  matrix.setBrightness(40);
+  matrix.fillScreen(matrix.Color(255, 255, 255));
+
+  // Synthetic map: each LED a little dimmer than the one before it
+  // along the strip, with blue trimmed slightly more.
+  for (uint16_t i = 0; i < matrix.numPixels(); i++) {
+    gains[i * 3]     = 255 - i;
+    gains[i * 3 + 1] = 255 - i;
+    gains[i * 3 + 2] = 235 - i;
+  }
+
+  uint32_t plain = timeShow();
+  matrix.setCorrectionMap(gains);
+  uint32_t corrected = timeShow();
+  Serial.print(F("show() without correction (us): "));
+  Serial.println(plain);
+  Serial.print(F("show() with correction (us): "));
+  Serial.println(corrected);
+  Serial.print(F("Correction cost per frame (us): "));
+  Serial.println(corrected - plain);
+}
+
+void loop() {
+  matrix.show();
+  delay(1000);
+}
@@ -0,0 +1,33 @@
+// Adafruit_DotStarMatrix example: seconds counter. Each update only
+// clears and redraws the digits that changed (usually just the last one)
+// instead of filling the screen and printing the whole number again.
+
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_DotStarMatrix.h>
+#include <Adafruit_DotStarMatrixDigits.h>
+#include <Adafruit_DotStar.h>
+
+#define DATAPIN  4
+#define CLOCKPIN 5
+
+Adafruit_DotStarMatrix matrix = Adafruit_DotStarMatrix(
+  12, 8, DATAPIN, CLOCKPIN,
+  DS_MATRIX_BOTTOM     + DS_MATRIX_LEFT +
+  DS_MATRIX_ROWS + DS_MATRIX_ZIGZAG,
+  DOTSTAR_BGR);
+
+Adafruit_DotStarMatrixDigits digits(matrix);
+
+void setup() {
+  matrix.begin();
+  matrix.setBrightness(40);
+  digits.begin(2); // Two 6x8 cells in the built-in font
+  digits.setColors(matrix.Color(255, 160, 0), matrix.Color(0, 0, 0));
+}
+
+void loop() {
+  digits.drawNumber((millis() / 1000) % 100, '0');
+  matrix.show();
+  delay(50);
+}
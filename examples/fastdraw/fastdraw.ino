@@ -0,0 +1,71 @@
+// Adafruit_DotStarMatrix example: statically dispatched drawing. The
+// same shapes are drawn through the usual Adafruit_GFX functions, where
+// every pixel is a virtual drawPixel() call, and through
+// Adafruit_DotStarMatrixFast, where pixel mapping is inlined into each
+// shape's loop. Timings are printed to the Serial console.
+
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_DotStarMatrix.h>
+#include <Adafruit_DotStarMatrixFast.h>
+#include <Adafruit_DotStar.h>
+
+#define DATAPIN  4
+#define CLOCKPIN 5
+#define MATRIX_W 12
+#define MATRIX_H  6
+#define REPEAT 100
+
+Adafruit_DotStarMatrix matrix = Adafruit_DotStarMatrix(
+  MATRIX_W, MATRIX_H, DATAPIN, CLOCKPIN,
+  DS_MATRIX_BOTTOM     + DS_MATRIX_LEFT +
+  DS_MATRIX_ROWS + DS_MATRIX_ZIGZAG,
+  DOTSTAR_BGR);
+
+Adafruit_DotStarMatrixFast fast(matrix);
+
+// Test scene, drawn through either front end (same function names)
+#define SCENE(d, i)                                                           \
+  d.drawLine(0, 0, MATRIX_W - 1, MATRIX_H - 1, i * 0x0841);                   \
+  d.drawLine(MATRIX_W - 1, 0, 0, MATRIX_H - 1, i * 0x0841);                   \
+  d.drawCircle(MATRIX_W / 2, MATRIX_H / 2, MATRIX_H / 2, i * 0x0841);         \
+  d.fillCircle(MATRIX_W / 2, MATRIX_H / 2, MATRIX_H / 3, i * 0x0841);         \
+  d.fillTriangle(0, 0, MATRIX_W - 1, MATRIX_H / 2, 2, MATRIX_H - 1,           \
+                 i * 0x0841);                                                 \
+  d.drawChar(3, 0, 'A' + (i % 26), 0xFFFF, i * 0x0841, 1)
+
+// Microseconds per scene, averaged
+uint32_t timeGFX(void) {
+  uint32_t t = micros();
+  for (uint16_t i = 0; i < REPEAT; i++) {
+    SCENE(matrix, i);
+  }
+  return (micros() - t) / REPEAT;
+}
+
+uint32_t timeFast(void) {
+  uint32_t t = micros();
+  for (uint16_t i = 0; i < REPEAT; i++) {
+    SCENE(fast, i);
+  }
+  return (micros() - t) / REPEAT;
+}
+
+void setup() {
+  Serial.begin(115200);
+  matrix.begin();
+  matrix.setBrightness(40);
+  matrix.setRotation(1);
+  fast.sync(); // Rotation changed since fast was constructed
+
+  uint32_t gfx = timeGFX();
+  uint32_t inl = timeFast();
+  Serial.print(F("Adafruit_GFX scene (us): "));
+  Serial.println(gfx);
+  Serial.print(F("Adafruit_DotStarMatrixFast scene (us): "));
+  Serial.println(inl);
+  matrix.show();
+}
+
+void loop() {
+}
@@ -0,0 +1,38 @@
+// 8x8 animated GIF, 8 frames: a diamond of cycling rainbow stripes.
+
+const uint8_t anim[] PROGMEM = {
+  0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x08, 0x00, 0x08, 0x00, 0x82, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x80, 0xFF, 0x60, 0x00, 0xFF, 0xFF, 0x00,
+  0xA0, 0x21, 0xFF, 0x0B, 0x4E, 0x45, 0x54, 0x53, 0x43, 0x41, 0x50, 0x45,
+  0x32, 0x2E, 0x30, 0x03, 0x01, 0x00, 0x00, 0x00, 0x21, 0xF9, 0x04, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08,
+  0x00, 0x00, 0x03, 0x17, 0x08, 0x4A, 0xA5, 0xCE, 0xE6, 0xBC, 0x12, 0x83,
+  0x00, 0xF0, 0xD8, 0x91, 0x37, 0x03, 0x9A, 0xC0, 0x35, 0x8A, 0xF8, 0x39,
+  0x18, 0x09, 0x24, 0x00, 0x21, 0xF9, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x2C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x03, 0x17,
+  0x08, 0x5A, 0xA6, 0xCE, 0x27, 0x3C, 0x13, 0xC5, 0x00, 0x30, 0x58, 0x92,
+  0x37, 0x03, 0xDA, 0xC0, 0x35, 0x8A, 0xF8, 0x39, 0x18, 0x09, 0x24, 0x00,
+  0x21, 0xF9, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x03, 0x17, 0x08, 0x6A, 0xA7, 0xCE,
+  0x41, 0xBC, 0x13, 0x07, 0x01, 0x50, 0xD8, 0x92, 0x37, 0x03, 0x1A, 0xC1,
+  0x35, 0x8A, 0xF8, 0x39, 0x18, 0x09, 0x24, 0x00, 0x21, 0xF9, 0x04, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08,
+  0x00, 0x00, 0x03, 0x17, 0x08, 0x7A, 0xA1, 0xCE, 0x62, 0xBC, 0x10, 0x49,
+  0x01, 0x70, 0x58, 0x93, 0x37, 0x03, 0x5A, 0xC1, 0x35, 0x8A, 0xF8, 0x39,
+  0x18, 0x09, 0x24, 0x00, 0x21, 0xF9, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x2C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x03, 0x17,
+  0x08, 0x1A, 0xA2, 0xCE, 0x83, 0x3C, 0x11, 0x8B, 0x01, 0x90, 0xD8, 0x93,
+  0x37, 0x03, 0x9A, 0xC1, 0x35, 0x8A, 0xF8, 0x39, 0x18, 0x09, 0x24, 0x00,
+  0x21, 0xF9, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x03, 0x17, 0x08, 0x2A, 0xA3, 0xCE,
+  0xA4, 0xBC, 0x11, 0xCD, 0x01, 0xB0, 0xD8, 0x90, 0x37, 0x03, 0xDA, 0xC1,
+  0x35, 0x8A, 0xF8, 0x39, 0x18, 0x09, 0x24, 0x00, 0x21, 0xF9, 0x04, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08,
+  0x00, 0x00, 0x03, 0x17, 0x08, 0x3A, 0xA4, 0xCE, 0xC5, 0x3C, 0x12, 0x4F,
+  0x00, 0xD0, 0x58, 0x91, 0x37, 0x03, 0x5A, 0xC0, 0x35, 0x8A, 0xF8, 0x39,
+  0x18, 0x09, 0x24, 0x00, 0x21, 0xF9, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x2C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x03, 0x17,
+  0x08, 0x4A, 0xA5, 0xCE, 0xE6, 0xBC, 0x12, 0x83, 0x00, 0xF0, 0xD8, 0x91,
+  0x37, 0x03, 0x9A, 0xC0, 0x35, 0x8A, 0xF8, 0x39, 0x18, 0x09, 0x24, 0x00,
+  0x3B};
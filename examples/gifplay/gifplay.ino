@@ -0,0 +1,50 @@
+// Adafruit_DotStarMatrix example: play an animated GIF stored in flash.
+// Frames are decoded a scanline at a time straight into the matrix, and
+// each frame's delay from the GIF is honored. Decode time per frame is
+// printed to the Serial console as a simple benchmark.
+// Needs a 32-bit board (the GIF decoder uses about 18K of RAM).
+
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_DotStarMatrix.h>
+#include <Adafruit_DotStarMatrixGIF.h>
+#include <Adafruit_DotStar.h>
+#include "anim.h"
+
+#define DATAPIN  4
+#define CLOCKPIN 5
+
+Adafruit_DotStarMatrix matrix = Adafruit_DotStarMatrix(
+  8, 8, DATAPIN, CLOCKPIN,
+  DS_MATRIX_TOP     + DS_MATRIX_RIGHT +
+  DS_MATRIX_COLUMNS + DS_MATRIX_PROGRESSIVE,
+  DOTSTAR_BRG);
+
+Adafruit_DotStarMatrixGIF gif(matrix);
+
+void setup() {
+  Serial.begin(115200);
+  matrix.begin();
+  matrix.setBrightness(40);
+  if (!gif.begin(anim, sizeof(anim))) {
+    Serial.println(F("Not a GIF"));
+    for(;;);
+  }
+}
+
+uint32_t decodeTime = 0;
+uint16_t frames     = 0;
+
+void loop() {
+  uint32_t t = micros();
+  if (gif.update()) {
+    decodeTime += micros() - t;
+    matrix.show();
+    if (++frames >= 100) {
+      Serial.print(F("Average decode time per frame (us): "));
+      Serial.println(decodeTime / frames);
+      decodeTime = 0;
+      frames     = 0;
+    }
+  }
+}
@@ -0,0 +1,65 @@
+// Adafruit_DotStarMatrix example: Conway's Game of Life. Cells are packed
+// 32 to a word and stepped a word at a time, and only cells that changed
+// are redrawn, so this keeps up with large matrices. When the population
+// dies out or settles into a short cycle, a new random soup is seeded.
+// Time per generation is printed to the Serial console.
+
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_DotStarMatrix.h>
+#include <Adafruit_DotStarMatrixLife.h>
+#include <Adafruit_DotStar.h>
+
+#define DATAPIN  4
+#define CLOCKPIN 5
+
+Adafruit_DotStarMatrix matrix = Adafruit_DotStarMatrix(
+  12, 6, DATAPIN, CLOCKPIN,
+  DS_MATRIX_BOTTOM     + DS_MATRIX_LEFT +
+  DS_MATRIX_ROWS + DS_MATRIX_ZIGZAG,
+  DOTSTAR_BGR);
+
+Adafruit_DotStarMatrixLife life(matrix);
+
+uint32_t history[4]; // Recent populations, to spot still lifes/blinkers
+
+void seed(void) {
+  life.randomize(35);
+  life.setColors(matrix.Color(random(256), random(256), random(256)),
+                 matrix.Color(0, 0, 16));
+  memset(history, 0, sizeof(history));
+}
+
+void setup() {
+  Serial.begin(115200);
+  matrix.begin();
+  matrix.setBrightness(40);
+  if (!life.begin()) {
+    Serial.println(F("Out of memory"));
+    for(;;);
+  }
+  life.setRule(DS_LIFE_CONWAY);
+  seed();
+}
+
+void loop() {
+  uint32_t t = micros();
+  life.draw();
+  life.step();
+  t = micros() - t;
+  matrix.show();
+
+  uint32_t pop = life.population();
+  if (!pop || (pop == history[1] && pop == history[3])) {
+    seed();
+  } else {
+    memmove(history + 1, history, sizeof(history) - sizeof(history[0]));
+    history[0] = pop;
+  }
+
+  if (!(life.getGeneration() % 100)) {
+    Serial.print(F("Draw + step time (us): "));
+    Serial.println(t);
+  }
+  delay(100);
+}
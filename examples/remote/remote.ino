@@ -0,0 +1,34 @@
+// Adafruit_DotStarMatrix example: draw whatever a host computer sends
+// over USB serial, using the compact binary command protocol in
+// Adafruit_DotStarMatrixProtocol.h. The host side can use the small C
+// encoder in extras/dsremote.c; commands are drawn as they arrive and
+// appear on the LEDs when the host sends a SHOW command.
+
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_DotStarMatrix.h>
+#include <Adafruit_DotStarMatrixRemote.h>
+#include <Adafruit_DotStar.h>
+
+#define DATAPIN  4
+#define CLOCKPIN 5
+
+Adafruit_DotStarMatrix matrix = Adafruit_DotStarMatrix(
+  12, 6, DATAPIN, CLOCKPIN,
+  DS_MATRIX_BOTTOM     + DS_MATRIX_LEFT +
+  DS_MATRIX_ROWS + DS_MATRIX_PROGRESSIVE,
+  DOTSTAR_BGR);
+
+Adafruit_DotStarMatrixRemote remote(matrix);
+
+void setup() {
+  Serial.begin(115200);
+  matrix.begin();
+  matrix.setTextWrap(false);
+  matrix.setBrightness(40);
+  matrix.show();
+}
+
+void loop() {
+  remote.process(Serial);
+}
@@ -0,0 +1,157 @@
+// Adafruit_DotStarMatrix example: library self-test. Runs a set of
+// checks on the pixel buffer (no LEDs need be connected) and prints the
+// results to the Serial console. Each check covers a sequence of calls
+// that has gone wrong before.
+
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_DotStarMatrix.h>
+#include <Adafruit_DotStarMatrixGIF.h>
+#include <Adafruit_DotStar.h>
+
+#define DATAPIN  4
+#define CLOCKPIN 5
+
+// Every check uses the same simple wiring, row by row from the top left
+#define LAYOUT \
+  (DS_MATRIX_TOP + DS_MATRIX_LEFT + DS_MATRIX_ROWS + DS_MATRIX_PROGRESSIVE)
+
+// Declare and start a w x h test matrix called 'name'
+#define TEST_MATRIX(name, w, h)                                              \
+  Adafruit_DotStarMatrix name(w, h, DATAPIN, CLOCKPIN, LAYOUT, DOTSTAR_BGR); \
+  name.begin()
+
+uint8_t failures = 0;
+
+void check(const __FlashStringHelper *name, bool ok) {
+  Serial.print(ok ? F("PASS  ") : F("FAIL  "));
+  Serial.println(name);
+  if (!ok) failures++;
+}
+
+// Number of pixels in the buffer that aren't off
+uint16_t countLit(Adafruit_DotStarMatrix &m) {
+  uint16_t n = 0;
+  for (uint16_t i = 0; i < m.numPixels(); i++)
+    if (m.getPixelColor(i)) n++;
+  return n;
+}
+
+// Calibration set on an owning matrix, then a view attached past the end
+// of its strip: the calibration buffers must grow with the strip.
+void testCalibrationThenView(void) {
+  TEST_MATRIX(owner, 8, 4);
+  uint8_t gains[8 * 4 * 3];
+  memset(gains, 128, sizeof(gains));
+  owner.setCorrectionMap(gains);
+  owner.setTileCalibration(0, 255, 200, 100);
+
+  Adafruit_DotStarMatrix view(owner, 32, 4, 4, LAYOUT);
+  owner.fillScreen(owner.Color(255, 255, 255));
+  view.fillScreen(view.Color(255, 0, 0));
+  owner.show();
+
+  bool ok = (owner.numPixels() == 48);
+  for (uint8_t i = 0; i < 32; i++) // Restored after show()
+    if (owner.getPixelColor(i) != 0xFFFFFF) ok = false;
+  for (uint8_t i = 0; i < 16; i++)
+    if (view.getPixelColor(i) != 0xFF0000) ok = false;
+  check(F("calibration, then view past end of strip"), ok);
+}
+
+// setLayout() on an owning matrix must stay within its own LEDs, not
+// clear (or grow over) those of views attached after it.
+void testLayoutWithView(void) {
+  TEST_MATRIX(owner, 8, 4);
+  Adafruit_DotStarMatrix view(owner, 32, 4, 4, LAYOUT);
+  view.fillScreen(view.Color(0, 255, 0));
+
+  bool ok = owner.setLayout(4, 4, LAYOUT);
+  ok = ok && !owner.setLayout(8, 6, LAYOUT);
+  for (uint8_t i = 0; i < 16; i++)
+    if (view.getPixelColor(i) != 0x00FF00) ok = false;
+  check(F("setLayout() leaves views alone"), ok);
+}
+
+// fill() and clear() must keep the power estimate in step with the
+// buffer, same as drawing: compare against a fresh scan of the buffer.
+void testPowerAfterFill(void) {
+  TEST_MATRIX(matrix, 8, 4);
+  matrix.setPowerLimit(1000);
+  matrix.fill(0xFFFFFF);
+  matrix.fill(0x000080, 4, 8);
+  uint32_t estimate = matrix.getPowerEstimate();
+  matrix.setPowerLimit(1000); // Rescans buffer
+  bool ok = (matrix.getPowerEstimate() == estimate);
+  matrix.clear();
+  ok = ok && !matrix.getPowerEstimate();
+  check(F("power estimate after fill() and clear()"), ok);
+}
+
+// Text printed on a virtual canvas past the first screen width must
+// show up once the viewport is moved there.
+void testViewportText(void) {
+  TEST_MATRIX(matrix, 16, 8);
+  matrix.setTextWrap(false);
+  matrix.setTextColor(matrix.Color(255, 255, 255));
+  matrix.print(F("AB"));
+  uint16_t expected = countLit(matrix);
+
+  matrix.clear();
+  matrix.setViewport(40, 0);
+  matrix.setCursor(40, 0);
+  matrix.print(F("AB"));
+  check(F("print() in viewport past first screen"),
+        expected && (countLit(matrix) == expected) &&
+        (matrix.getCursorX() == 52));
+}
+
+#ifndef __AVR__ // GIF decoder needs about 18K of RAM
+
+// 4x4 GIF, all white
+const uint8_t whiteSquare[] PROGMEM = {
+  0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x04, 0x00, 0x04, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x00, 0x02, 0x04, 0x8C, 0x8F, 0x19, 0x05, 0x00,
+  0x3B };
+
+// Likewise for GIF frames: placed on the virtual canvas, and clipped to
+// the part of it on screen. Whole, cut off on the left, cut off on the
+// right.
+void testViewportGIF(void) {
+  TEST_MATRIX(matrix, 16, 8);
+  matrix.setViewport(40, 0);
+  Adafruit_DotStarMatrixGIF *gif = new Adafruit_DotStarMatrixGIF(matrix);
+  const int16_t x[] = { 44, 38, 54 };
+  const uint16_t expected[] = { 16, 8, 8 };
+  bool ok = true;
+  for (uint8_t i = 0; i < 3; i++) {
+    matrix.clear();
+    ok = ok && gif->begin(whiteSquare, sizeof(whiteSquare), x[i], 2) &&
+         (gif->drawFrame() >= 0) && (countLit(matrix) == expected[i]);
+  }
+  delete gif;
+  check(F("GIF in viewport past first screen"), ok);
+}
+
+#endif // __AVR__
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) delay(10);
+  Serial.println(F("DotStarMatrix self-test"));
+
+  testCalibrationThenView();
+  testLayoutWithView();
+  testPowerAfterFill();
+  testViewportText();
+#ifndef __AVR__
+  testViewportGIF();
+#endif
+
+  Serial.print(failures);
+  Serial.println(F(" failure(s)"));
+}
+
+void loop() {
+}
@@ -0,0 +1,49 @@
+// Adafruit_DotStarMatrix example: two independent displays on one data
+// line. A 12x6 main panel is followed on the same strip by an 8x8 status
+// panel; each is its own matrix object with its own layout, rotation and
+// text settings, but they share one pixel buffer and one show().
+
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_DotStarMatrix.h>
+#include <Adafruit_DotStar.h>
+
+#define DATAPIN  4
+#define CLOCKPIN 5
+
+// Main panel: LEDs 0-71 of the strip
+Adafruit_DotStarMatrix matrix = Adafruit_DotStarMatrix(
+  12, 6, DATAPIN, CLOCKPIN,
+  DS_MATRIX_BOTTOM     + DS_MATRIX_LEFT +
+  DS_MATRIX_ROWS + DS_MATRIX_PROGRESSIVE,
+  DOTSTAR_BGR);
+
+// Status panel: LEDs 72-135, wired differently, mounted sideways
+Adafruit_DotStarMatrix status = Adafruit_DotStarMatrix(
+  matrix, 72, 8, 8,
+  DS_MATRIX_TOP     + DS_MATRIX_RIGHT +
+  DS_MATRIX_COLUMNS + DS_MATRIX_ZIGZAG);
+
+void setup() {
+  matrix.begin(); // Only the owning matrix is started
+  matrix.setTextWrap(false);
+  matrix.setBrightness(40);
+  matrix.setTextColor(matrix.Color(255, 0, 0));
+  status.setRotation(1);
+}
+
+int x = matrix.width();
+uint8_t beat = 0;
+
+void loop() {
+  matrix.fillScreen(0);
+  matrix.setCursor(x, 0);
+  matrix.print(F("Howdy"));
+  if (--x < -30) x = matrix.width();
+
+  status.fillScreen(0);
+  status.fillCircle(3, 3, (beat++ >> 2) & 3, status.Color(0, 255, 0));
+
+  matrix.show(); // Both panels in one transfer
+  delay(100);
+}
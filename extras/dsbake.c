@@ -0,0 +1,283 @@
+// THIS IS NOT ARDUINO CODE -- DON'T INCLUDE IN YOUR SKETCH.  It's a
+// command-line tool that converts raw 24-bit RGB video frames into a
+// frame file (see dsframes.h) for a specific matrix, doing all of the
+// per-pixel work ahead of time that would otherwise happen on the device
+// at playback: scaling to the matrix resolution (box filter, averaged in
+// linear light), gamma correction, dithering, LED color order, and
+// reordering into strip order.  Strip order comes from the library's own
+// layout code (Adafruit_DotStarMatrixLayout.h), so pixels land exactly
+// where drawPixel() would put them.
+//
+// The result can be played on a host with dsplay, or on a device by
+// copying each frame straight into the DotStar pixel buffer, e.g.
+//   file.read(matrix.getPixels(), matrix.numPixels() * 3);
+//   matrix.show();
+//
+// Build: cc -O2 -o dsbake dsbake.c -lm
+// Usage: dsbake -i WxH -s WxH [options] outfile < frames.rgb
+//   -i  Input frame size in pixels (required)
+//   -s  Matrix size, or size of each tile if tiled (required)
+//   -t  Number of tiles, e.g. 4x2 (default: not tiled)
+//   -l  Layout, DS_MATRIX_* and DS_TILE_* names joined with '+', or a
+//       number (default DS_MATRIX_TOP+DS_MATRIX_LEFT+DS_MATRIX_ROWS)
+//   -o  LED color order: rgb, rbg, grb, gbr, brg or bgr (default brg)
+//   -d  Milliseconds per frame (default 33)
+//   -b  Brightness 0-255, baked into the frames (default 255)
+//   -g  Gamma (default 2.6, same as gamma.c)
+//   -w  Write APA102 wire format instead of buffer format
+// Example, using ffmpeg to supply frames:
+//   ffmpeg -i show.mp4 -f rawvideo -pix_fmt rgb24 - |
+//     dsbake -i 1280x720 -s 32x8 -t 1x4 -w show.dsf
+
+#include "../Adafruit_DotStarMatrixLayout.h"
+#include "dsframes.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static const struct {
+  const char *name;
+  uint8_t value;
+} flags[] = {{"DS_MATRIX_TOP", DS_MATRIX_TOP},
+             {"DS_MATRIX_BOTTOM", DS_MATRIX_BOTTOM},
+             {"DS_MATRIX_LEFT", DS_MATRIX_LEFT},
+             {"DS_MATRIX_RIGHT", DS_MATRIX_RIGHT},
+             {"DS_MATRIX_ROWS", DS_MATRIX_ROWS},
+             {"DS_MATRIX_COLUMNS", DS_MATRIX_COLUMNS},
+             {"DS_MATRIX_PROGRESSIVE", DS_MATRIX_PROGRESSIVE},
+             {"DS_MATRIX_ZIGZAG", DS_MATRIX_ZIGZAG},
+             {"DS_TILE_TOP", DS_TILE_TOP},
+             {"DS_TILE_BOTTOM", DS_TILE_BOTTOM},
+             {"DS_TILE_LEFT", DS_TILE_LEFT},
+             {"DS_TILE_RIGHT", DS_TILE_RIGHT},
+             {"DS_TILE_ROWS", DS_TILE_ROWS},
+             {"DS_TILE_COLUMNS", DS_TILE_COLUMNS},
+             {"DS_TILE_PROGRESSIVE", DS_TILE_PROGRESSIVE},
+             {"DS_TILE_ZIGZAG", DS_TILE_ZIGZAG}};
+
+// Color orders, encoded the same as the DOTSTAR_* values in
+// Adafruit_DotStar.h: byte offsets of R, G, B in 2-bit fields.
+static const struct {
+  const char *name;
+  uint8_t value;
+} orders[] = {{"rgb", 0 | (1 << 2) | (2 << 4)},
+              {"rbg", 0 | (2 << 2) | (1 << 4)},
+              {"grb", 1 | (0 << 2) | (2 << 4)},
+              {"gbr", 2 | (0 << 2) | (1 << 4)},
+              {"brg", 1 | (2 << 2) | (0 << 4)},
+              {"bgr", 2 | (1 << 2) | (0 << 4)}};
+
+static int parseSize(const char *s, int *w, int *h) {
+  return (sscanf(s, "%dx%d", w, h) == 2) && (*w > 0) && (*h > 0);
+}
+
+static int parseLayout(const char *s, int *type) {
+  char buf[256], *tok;
+  size_t i;
+
+  if ((*s >= '0') && (*s <= '9')) {
+    *type = strtol(s, NULL, 0);
+    return 1;
+  }
+  (void)strncpy(buf, s, sizeof(buf) - 1);
+  buf[sizeof(buf) - 1] = 0;
+  *type = 0;
+  for (tok = strtok(buf, "+ "); tok; tok = strtok(NULL, "+ ")) {
+    for (i = 0; i < sizeof(flags) / sizeof(flags[0]); i++) {
+      if (!strcmp(tok, flags[i].name)) {
+        *type |= flags[i].value;
+        break;
+      }
+    }
+    if (i >= sizeof(flags) / sizeof(flags[0])) {
+      (void)fprintf(stderr, "Unknown layout flag '%s'\n", tok);
+      return 0;
+    }
+  }
+  return 1;
+}
+
+int main(int argc, char *argv[]) {
+  int inW = 0, inH = 0, matW = 0, matH = 0, tX = 0, tY = 0;
+  int type = DS_MATRIX_TOP + DS_MATRIX_LEFT + DS_MATRIX_ROWS;
+  int delay = 33, brightness = 255, wire = 0, c;
+  uint8_t order = orders[4].value; // brg, same default as Adafruit_DotStar
+  double gamma = 2.6;
+  size_t i;
+
+  while ((c = getopt(argc, argv, "i:s:t:l:o:d:b:g:w")) != -1) {
+    switch (c) {
+    case 'i':
+      if (!parseSize(optarg, &inW, &inH))
+        return 1;
+      break;
+    case 's':
+      if (!parseSize(optarg, &matW, &matH))
+        return 1;
+      break;
+    case 't':
+      if (!parseSize(optarg, &tX, &tY))
+        return 1;
+      break;
+    case 'l':
+      if (!parseLayout(optarg, &type))
+        return 1;
+      break;
+    case 'o':
+      for (i = 0; i < sizeof(orders) / sizeof(orders[0]); i++) {
+        if (!strcmp(optarg, orders[i].name))
+          break;
+      }
+      if (i >= sizeof(orders) / sizeof(orders[0])) {
+        (void)fprintf(stderr, "Unknown color order '%s'\n", optarg);
+        return 1;
+      }
+      order = orders[i].value;
+      break;
+    case 'd':
+      delay = atoi(optarg);
+      break;
+    case 'b':
+      brightness = atoi(optarg);
+      break;
+    case 'g':
+      gamma = atof(optarg);
+      break;
+    case 'w':
+      wire = 1;
+      break;
+    default:
+      optind = argc; // Force usage message
+      break;
+    }
+  }
+  if (!inW || !matW || (optind != argc - 1) || (matW > 255) ||
+      (matH > 255) || (tX > 255) || (tY > 255)) {
+    (void)fprintf(stderr,
+                  "Usage: %s -i WxH -s WxH [-t TXxTY] [-l layout] [-o order] "
+                  "[-d ms] [-b brightness] [-g gamma] [-w] outfile\n",
+                  argv[0]);
+    return 1;
+  }
+
+  // Total display size; the layout code treats tilesX == 0 as untiled
+  int outW = matW * (tX ? tX : 1), outH = matH * (tY ? tY : 1);
+  long numPixels = (long)outW * outH;
+  if (numPixels > 65535) {
+    (void)fprintf(stderr, "Display too large (%ld pixels)\n", numPixels);
+    return 1;
+  }
+
+  FILE *out = strcmp(argv[optind], "-") ? fopen(argv[optind], "wb") : stdout;
+  if (!out) {
+    perror(argv[optind]);
+    return 1;
+  }
+
+  dsf_header hdr;
+  memcpy(hdr.magic, DSF_MAGIC, 4);
+  hdr.numPixels = numPixels;
+  hdr.flags = wire ? DSF_WIRE : 0;
+  hdr.ledType = order;
+  hdr.frameDelay = delay;
+  hdr.reserved = 0;
+  hdr.numFrames = 0xFFFFFFFF; // Patched at end if output is seekable
+  (void)fwrite(&hdr, DSF_HEADER_SIZE, 1, out);
+
+  // Strip index of every display pixel, and where each color byte goes
+  uint16_t *strip = malloc(numPixels * sizeof(uint16_t));
+  uint8_t offset[3] = {order & 3, (order >> 2) & 3, (order >> 4) & 3};
+  for (int y = 0; y < outH; y++) {
+    for (int x = 0; x < outW; x++)
+      strip[y * outW + x] = dsMatrixRemap(type, matW, matH, tX, tY, x, y);
+  }
+
+  // Source column/row span averaged into each display column/row
+  int *x0 = malloc((outW + 1) * sizeof(int));
+  int *y0 = malloc((outH + 1) * sizeof(int));
+  for (int x = 0; x <= outW; x++)
+    x0[x] = (long)x * inW / outW;
+  for (int y = 0; y <= outH; y++)
+    y0[y] = (long)y * inH / outH;
+
+  // Input byte to linear light, with brightness folded in so it benefits
+  // from dithering rather than being truncated afterward.
+  float linear[256];
+  for (i = 0; i < 256; i++)
+    linear[i] = pow((float)i / 255.0, gamma) * 255.0 * brightness / 255.0;
+
+  size_t inSize = (size_t)inW * inH * 3;
+  size_t frameSize = DSF_FRAME_SIZE(numPixels, hdr.flags);
+  uint8_t *in = malloc(inSize);
+  uint8_t *frame = calloc(frameSize, 1);
+  float *err = calloc((outW + 2) * 2 * 3, sizeof(float)); // 2 rows of error
+  if (!strip || !x0 || !y0 || !in || !frame || !err) {
+    perror("malloc");
+    return 1;
+  }
+  uint8_t *pixels = frame; // Start of pixel data within frame
+  int stride = 3;          // Bytes per pixel within frame
+  if (wire) {
+    pixels += 4; // Start frame is zeros from calloc()
+    stride = 4;
+    for (long p = 0; p < numPixels; p++)
+      pixels[p * 4] = 0xFF; // Full 5-bit global brightness
+    memset(frame + frameSize - DSF_END_BYTES(numPixels), 0xFF,
+           DSF_END_BYTES(numPixels));
+    for (i = 0; i < 3; i++)
+      offset[i]++;
+  }
+
+  uint32_t numFrames = 0;
+  while (fread(in, 1, inSize, stdin) == inSize) {
+    memset(err, 0, (outW + 2) * 2 * 3 * sizeof(float));
+    for (int y = 0; y < outH; y++) {
+      float *cur = &err[((y & 1) * (outW + 2) + 1) * 3];
+      float *next = &err[((~y & 1) * (outW + 2) + 1) * 3];
+      memset(next - 3, 0, (outW + 2) * 3 * sizeof(float));
+      int ya = y0[y], yb = (y0[y + 1] > ya) ? y0[y + 1] : ya + 1;
+      for (int x = 0; x < outW; x++) {
+        int xa = x0[x], xb = (x0[x + 1] > xa) ? x0[x + 1] : xa + 1;
+        float sum[3] = {0, 0, 0};
+        for (int sy = ya; sy < yb; sy++) {
+          const uint8_t *s = &in[((size_t)sy * inW + xa) * 3];
+          for (int sx = xa; sx < xb; sx++, s += 3) {
+            sum[0] += linear[s[0]];
+            sum[1] += linear[s[1]];
+            sum[2] += linear[s[2]];
+          }
+        }
+        float area = (float)(xb - xa) * (yb - ya);
+        uint8_t *p = &pixels[(size_t)strip[y * outW + x] * stride];
+        for (c = 0; c < 3; c++) {
+          // Floyd-Steinberg error diffusion
+          float v = sum[c] / area + cur[x * 3 + c];
+          int q = (int)(v + 0.5);
+          q = (q < 0) ? 0 : (q > 255) ? 255 : q;
+          float e = v - q;
+          cur[(x + 1) * 3 + c] += e * 7 / 16;
+          next[(x - 1) * 3 + c] += e * 3 / 16;
+          next[x * 3 + c] += e * 5 / 16;
+          next[(x + 1) * 3 + c] += e * 1 / 16;
+          p[offset[c]] = q;
+        }
+      }
+    }
+    if (fwrite(frame, 1, frameSize, out) != frameSize) {
+      perror(argv[optind]);
+      return 1;
+    }
+    numFrames++;
+  }
+
+  if (!fseek(out, 0, SEEK_SET)) {
+    hdr.numFrames = numFrames;
+    (void)fwrite(&hdr, DSF_HEADER_SIZE, 1, out);
+  }
+  (void)fclose(out);
+  (void)fprintf(stderr, "%u frames, %ld pixels\n", numFrames, numPixels);
+
+  return 0;
+}
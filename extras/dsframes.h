@@ -0,0 +1,47 @@
+// THIS IS NOT ARDUINO CODE -- DON'T INCLUDE IN YOUR SKETCH.  It's the
+// frame file layout shared by the command-line tools in this directory
+// (dsplay, dsbake).  A frame file is a fixed 16-byte header followed by
+// numFrames back-to-back frames of identical size, so frame N is found
+// by arithmetic alone -- there is nothing to parse during playback.
+//
+// Frames are stored in strip order (pixel 0 first, exactly as they land
+// in the DotStar buffer), in one of two encodings:
+//   - Buffer format: 3 bytes per pixel, in the byte order of the LED
+//     type recorded in the header (the same layout Adafruit_DotStar
+//     keeps in RAM, so a device can copy a frame straight in).
+//   - Wire format (DSF_WIRE): the complete APA102 bitstream -- 4-byte
+//     start frame, 4 bytes per pixel (0xE0|brightness, then color bytes
+//     in LED order), and the end-of-frame clock bytes.  A host can hand
+//     this to the SPI driver untouched.
+// All multi-byte header fields are little-endian (the tools read and
+// write the header struct directly, so they assume a little-endian host).
+
+#ifndef _DSFRAMES_H_
+#define _DSFRAMES_H_
+
+#include <stdint.h>
+
+#define DSF_MAGIC "DSMF"     // Header magic, first 4 bytes of file
+#define DSF_HEADER_SIZE 16   // Frames begin at this file offset
+#define DSF_WIRE 0x01        // Flag: frames are APA102 wire format
+
+typedef struct {
+  char magic[4];       // DSF_MAGIC
+  uint16_t numPixels;  // Pixels per frame
+  uint8_t flags;       // DSF_* flags
+  uint8_t ledType;     // DOTSTAR_* byte order of color data
+  uint16_t frameDelay; // Milliseconds per frame (0 = as fast as possible)
+  uint16_t reserved;   // Set to 0
+  uint32_t numFrames;  // Frames in file
+} dsf_header;
+
+// Size of the APA102 end frame for a given strip length; matches the
+// number of 0xFF bytes Adafruit_DotStar::show() issues.
+#define DSF_END_BYTES(n) (((n) + 15) / 16)
+
+// Bytes per frame for a given header (pixel count and encoding).
+#define DSF_FRAME_SIZE(n, flags)                                               \
+  (((flags)&DSF_WIRE) ? (4 + (size_t)(n)*4 + DSF_END_BYTES(n))                 \
+                      : ((size_t)(n)*3))
+
+#endif // _DSFRAMES_H_
@@ -0,0 +1,324 @@
+// THIS IS NOT ARDUINO CODE -- DON'T INCLUDE IN YOUR SKETCH.  It's a
+// command-line tool for Linux hosts (e.g. Raspberry Pi) that plays a
+// frame file (see dsframes.h) to a DotStar strip or matrix on a spidev
+// device, or to any other file/pipe.
+//
+// The frame file is mmap()ed, never read or parsed: each frame is handed
+// to the SPI driver directly from the mapping.  Files already in APA102
+// wire format (DSF_WIRE, e.g. from "dsbake -w") go out with no copy at
+// all; buffer-format files get a single encode pass per frame into a
+// small transfer buffer.  The kernel is told the access is sequential
+// and is asked to prefetch ahead of and drop pages behind the playhead,
+// so multi-gigabyte shows run in a small, constant amount of RAM.
+//
+// Build: cc -O2 -o dsplay dsplay.c
+// Usage: dsplay [-d device] [-s speed_hz] [-b brightness] [-c map] [-l]
+//               file
+//   -d  Output device or file (default /dev/spidev0.0, which must exist:
+//       enable SPI first).  A regular file is created or overwritten.
+//   -s  SPI clock in Hz (default 8000000)
+//   -b  Brightness 0-255, buffer-format files or with -c (default 255)
+//   -c  Per-LED correction map: R, G, B gain bytes (255 = unchanged) for
+//       each LED in strip order, same format as the library's
+//       loadCorrectionMap().  Wire-format files are then re-encoded
+//       rather than sent directly from the mapping.
+//   -l  Loop forever
+
+#include "dsframes.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/spi/spidev.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define CHUNK 4096   // spidev's default per-transfer limit (bufsiz)
+#define MAXCHUNKS 64 // Transfers per SPI_IOC_MESSAGE
+#define READAHEAD 8  // Frames to prefetch ahead of the playhead
+
+static int isSPI = 0; // Set if output device accepts spidev ioctls
+static uint32_t speed = 8000000;
+
+// Issue one frame. On spidev the frame is split into bufsiz-sized
+// transfers that all point into the caller's buffer (usually the file
+// mapping itself), submitted together so the clock never pauses long
+// enough between chunks to matter.  Anything else gets plain write()s.
+static int output(int fd, const uint8_t *buf, size_t len) {
+  if (isSPI) {
+    struct spi_ioc_transfer xfer[MAXCHUNKS];
+    while (len) {
+      int n = 0;
+      memset(xfer, 0, sizeof(xfer));
+      while (len && (n < MAXCHUNKS)) {
+        size_t c = (len > CHUNK) ? CHUNK : len;
+        xfer[n].tx_buf = (unsigned long)buf;
+        xfer[n].len = c;
+        xfer[n].speed_hz = speed;
+        xfer[n].bits_per_word = 8;
+        buf += c;
+        len -= c;
+        n++;
+      }
+      if (ioctl(fd, SPI_IOC_MESSAGE(n), xfer) < 0)
+        return -1;
+    }
+  } else {
+    while (len) {
+      ssize_t n = write(fd, buf, len);
+      if (n < 0) {
+        if (errno == EINTR)
+          continue;
+        return -1;
+      }
+      buf += n;
+      len -= n;
+    }
+  }
+  return 0;
+}
+
+// Convert one frame to the APA102 bitstream, applying brightness the
+// same way Adafruit_DotStar::show() does (full-scale 5-bit global
+// brightness, color bytes scaled).  'in' points to the first color byte,
+// with 'stride' bytes from one LED to the next (3 for buffer format, 4 to
+// skip the header bytes of wire format).  If 'gain' is set, it holds a
+// per-byte scale (0-256) with brightness already folded in.
+static void encode(uint8_t *out, const uint8_t *in, uint16_t n, int stride,
+                   uint16_t scale, const uint16_t *gain) {
+  memset(out, 0, 4); // Start frame
+  out += 4;
+  while (n--) {
+    *out++ = 0xFF;
+    if (gain) {
+      *out++ = (in[0] * gain[0]) >> 8;
+      *out++ = (in[1] * gain[1]) >> 8;
+      *out++ = (in[2] * gain[2]) >> 8;
+      gain += 3;
+    } else if (scale) {
+      *out++ = (in[0] * scale) >> 8;
+      *out++ = (in[1] * scale) >> 8;
+      *out++ = (in[2] * scale) >> 8;
+    } else {
+      *out++ = in[0];
+      *out++ = in[1];
+      *out++ = in[2];
+    }
+    in += stride;
+  }
+}
+
+// Load a correction map (R, G, B per LED) and convert it to per-byte
+// scales in the frame's byte order, with brightness folded in.
+static uint16_t *loadMap(const char *filename, uint16_t n, uint8_t ledType,
+                         uint16_t scale) {
+  FILE *fp = fopen(filename, "rb");
+  if (!fp) {
+    perror(filename);
+    return NULL;
+  }
+  uint16_t *gain = malloc(n * 3 * sizeof(uint16_t));
+  if (!gain) {
+    perror("malloc");
+    (void)fclose(fp);
+    return NULL;
+  }
+  uint8_t off[3] = {ledType & 3, (ledType >> 2) & 3, (ledType >> 4) & 3};
+  uint8_t rgb[3];
+  for (uint16_t i = 0; i < n; i++) {
+    if (fread(rgb, 1, 3, fp) != 3) {
+      (void)fprintf(stderr, "%s: map is shorter than %u LEDs\n", filename,
+                    n);
+      free(gain);
+      (void)fclose(fp);
+      return NULL;
+    }
+    for (int c = 0; c < 3; c++)
+      gain[i * 3 + off[c]] = ((rgb[c] + 1) * (scale ? scale : 256)) >> 8;
+  }
+  (void)fclose(fp);
+  return gain;
+}
+
+int main(int argc, char *argv[]) {
+  const char *device = "/dev/spidev0.0", *mapFile = NULL;
+  int c, loop = 0, brightness = 255, deviceGiven = 0;
+
+  while ((c = getopt(argc, argv, "d:s:b:c:l")) != -1) {
+    switch (c) {
+    case 'd':
+      device = optarg;
+      deviceGiven = 1;
+      break;
+    case 's':
+      speed = strtoul(optarg, NULL, 0);
+      break;
+    case 'b':
+      brightness = atoi(optarg);
+      break;
+    case 'c':
+      mapFile = optarg;
+      break;
+    case 'l':
+      loop = 1;
+      break;
+    default:
+      (void)fprintf(stderr,
+                    "Usage: %s [-d device] [-s speed_hz] [-b brightness] "
+                    "[-c map] [-l] file\n",
+                    argv[0]);
+      return 1;
+    }
+  }
+  if (optind >= argc) {
+    (void)fprintf(stderr, "%s: no frame file given\n", argv[0]);
+    return 1;
+  }
+
+  int in = open(argv[optind], O_RDONLY);
+  if (in < 0) {
+    perror(argv[optind]);
+    return 1;
+  }
+  struct stat st;
+  if (fstat(in, &st) < 0) {
+    perror("fstat");
+    return 1;
+  }
+  if (st.st_size < DSF_HEADER_SIZE) {
+    (void)fprintf(stderr, "%s: not a frame file\n", argv[optind]);
+    return 1;
+  }
+
+  const uint8_t *map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, in, 0);
+  if (map == MAP_FAILED) {
+    perror("mmap");
+    return 1;
+  }
+  (void)close(in); // Mapping stays valid
+  (void)madvise((void *)map, st.st_size, MADV_SEQUENTIAL);
+
+  const dsf_header *hdr = (const dsf_header *)map;
+  if (memcmp(hdr->magic, DSF_MAGIC, 4)) {
+    (void)fprintf(stderr, "%s: not a frame file\n", argv[optind]);
+    return 1;
+  }
+  // Keep header fields in locals; the header page is released with the
+  // first frames during playback.
+  uint16_t numPixels = hdr->numPixels, frameDelay = hdr->frameDelay;
+  uint8_t flags = hdr->flags, ledType = hdr->ledType;
+  size_t frameSize = DSF_FRAME_SIZE(numPixels, flags);
+  uint32_t numFrames = hdr->numFrames;
+  if ((size_t)(st.st_size - DSF_HEADER_SIZE) / frameSize < numFrames)
+    numFrames = (st.st_size - DSF_HEADER_SIZE) / frameSize; // Truncated file
+  if (!numFrames) {
+    (void)fprintf(stderr, "%s: no frames\n", argv[optind]);
+    return 1;
+  }
+
+  uint16_t scale = (brightness >= 255) ? 0 : (brightness + 1);
+  uint16_t *gain = NULL;
+  if (mapFile && !(gain = loadMap(mapFile, numPixels, ledType, scale)))
+    return 1;
+
+  // Buffer-format files (and wire-format ones being corrected) need
+  // somewhere to put the encoded bitstream. The end-frame bytes never
+  // change, so fill them once here.
+  uint8_t *wire = NULL;
+  size_t wireSize = DSF_FRAME_SIZE(numPixels, DSF_WIRE);
+  if (!(flags & DSF_WIRE) || gain) {
+    if (!(wire = malloc(wireSize))) {
+      perror("malloc");
+      return 1;
+    }
+    memset(wire + wireSize - DSF_END_BYTES(numPixels), 0xFF,
+           DSF_END_BYTES(numPixels));
+  }
+
+  // Devices and pipes are opened as they are. Only a path given with -d
+  // may be a regular file, which is then created or truncated; without
+  // SPI enabled, the default spidev node doesn't exist, and creating a
+  // file there would just hide the problem.
+  struct stat dst;
+  int exists = (stat(device, &dst) == 0), oflags = O_WRONLY;
+  if (!deviceGiven && (!exists || !S_ISCHR(dst.st_mode))) {
+    (void)fprintf(stderr,
+                  "%s: no SPI device (is SPI enabled?); use -d for "
+                  "another output\n",
+                  device);
+    return 1;
+  }
+  if (!exists || S_ISREG(dst.st_mode))
+    oflags |= O_CREAT | O_TRUNC;
+  int out = open(device, oflags, 0644);
+  if (out < 0) {
+    perror(device);
+    return 1;
+  }
+  uint8_t mode = SPI_MODE_0;
+  if (ioctl(out, SPI_IOC_WR_MODE, &mode) == 0) {
+    isSPI = 1;
+    (void)ioctl(out, SPI_IOC_WR_MAX_SPEED_HZ, &speed);
+  }
+
+  const uint8_t *frames = map + DSF_HEADER_SIZE;
+  long pageSize = sysconf(_SC_PAGESIZE);
+  uintptr_t pageMask = ~(uintptr_t)(pageSize - 1);
+  struct timespec next;
+  (void)clock_gettime(CLOCK_MONOTONIC, &next);
+
+  do {
+    uintptr_t released = (uintptr_t)map; // Start of still-resident pages
+    for (uint32_t f = 0; f < numFrames; f++) {
+      const uint8_t *frame = frames + (size_t)f * frameSize;
+
+      // Prefetch the next few frames; release everything before this
+      // one so resident memory doesn't grow with file size.
+      uint32_t ahead = numFrames - 1 - f;
+      if (ahead > READAHEAD)
+        ahead = READAHEAD;
+      if (ahead) {
+        uintptr_t a = (uintptr_t)(frame + frameSize) & pageMask;
+        (void)madvise((void *)a,
+                      (uintptr_t)(frame + (ahead + 1) * frameSize) - a,
+                      MADV_WILLNEED);
+      }
+      uintptr_t done = (uintptr_t)frame & pageMask;
+      if (done > released) {
+        (void)madvise((void *)released, done - released, MADV_DONTNEED);
+        released = done;
+      }
+
+      if (wire) {
+        if (flags & DSF_WIRE) // Skip start frame, and header of each LED
+          encode(wire, frame + 5, numPixels, 4, scale, gain);
+        else
+          encode(wire, frame, numPixels, 3, scale, gain);
+        c = output(out, wire, wireSize);
+      } else {
+        c = output(out, frame, frameSize);
+      }
+      if (c < 0) {
+        perror(device);
+        return 1;
+      }
+
+      if (frameDelay) { // Absolute deadlines, so no drift
+        next.tv_nsec += (long)frameDelay * 1000000L;
+        while (next.tv_nsec >= 1000000000L) {
+          next.tv_nsec -= 1000000000L;
+          next.tv_sec++;
+        }
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next,
+                               NULL) == EINTR)
+          ;
+      }
+    }
+  } while (loop);
+
+  return 0;
+}
@@ -0,0 +1,115 @@
+// THIS IS NOT ARDUINO CODE -- DON'T INCLUDE IN YOUR SKETCH.  Host-side
+// encoder for the DotStarMatrix remote drawing protocol; see dsremote.h.
+// Build into your program along with dsremote.h, e.g.:
+//   cc -O2 -o myshow myshow.c dsremote.c
+
+#include "dsremote.h"
+#include "../Adafruit_DotStarMatrixProtocol.h"
+#include <string.h>
+
+void dsr_init(dsr_buffer *b, uint8_t *mem, size_t size) {
+  b->buf = mem;
+  b->size = size;
+  b->len = 0;
+}
+
+void dsr_reset(dsr_buffer *b) { b->len = 0; }
+
+// Same quantization as Adafruit_DotStarMatrix::Color()
+uint16_t dsr_color(uint8_t r, uint8_t g, uint8_t b) {
+  return ((uint16_t)(r & 0xF8) << 8) | ((uint16_t)(g & 0xFC) << 3) | (b >> 3);
+}
+
+// Append opcode and n 16-bit arguments, if there's room for them plus
+// 'extra' more bytes (which the caller then appends itself).
+static int put(dsr_buffer *b, uint8_t op, int n, const int16_t *args,
+               size_t extra) {
+  if ((b->len + 1 + n * 2 + extra) > b->size)
+    return -1;
+  b->buf[b->len++] = op;
+  for (int i = 0; i < n; i++) {
+    b->buf[b->len++] = (uint16_t)args[i] & 0xFF;
+    b->buf[b->len++] = (uint16_t)args[i] >> 8;
+  }
+  return 0;
+}
+
+int dsr_fill_rect(dsr_buffer *b, int16_t x, int16_t y, int16_t w, int16_t h,
+                  uint16_t color) {
+  int16_t a[] = {x, y, w, h, (int16_t)color};
+  return put(b, DSR_FILL_RECT, 5, a, 0);
+}
+
+int dsr_hline(dsr_buffer *b, int16_t x, int16_t y, int16_t w,
+              uint16_t color) {
+  int16_t a[] = {x, y, w, (int16_t)color};
+  return put(b, DSR_HLINE, 4, a, 0);
+}
+
+int dsr_vline(dsr_buffer *b, int16_t x, int16_t y, int16_t h,
+              uint16_t color) {
+  int16_t a[] = {x, y, h, (int16_t)color};
+  return put(b, DSR_VLINE, 4, a, 0);
+}
+
+int dsr_pixel(dsr_buffer *b, int16_t x, int16_t y, uint16_t color) {
+  int16_t a[] = {x, y, (int16_t)color};
+  return put(b, DSR_PIXEL, 3, a, 0);
+}
+
+int dsr_fill_screen(dsr_buffer *b, uint16_t color) {
+  int16_t a[] = {(int16_t)color};
+  return put(b, DSR_FILL_SCREEN, 1, a, 0);
+}
+
+// Strings longer than 255 characters are truncated
+int dsr_text(dsr_buffer *b, int16_t x, int16_t y, uint16_t color,
+             uint16_t bg, uint8_t size, const char *str) {
+  size_t len = strlen(str);
+  if (len > 255)
+    len = 255;
+  int16_t a[] = {x, y, (int16_t)color, (int16_t)bg};
+  if (put(b, DSR_TEXT, 4, a, 2 + len))
+    return -1;
+  b->buf[b->len++] = size;
+  b->buf[b->len++] = len;
+  memcpy(&b->buf[b->len], str, len);
+  b->len += len;
+  return 0;
+}
+
+// bits: h rows of (w + 7) / 8 bytes, MSB first, as for GFX drawBitmap()
+int dsr_bitmap(dsr_buffer *b, int16_t x, int16_t y, int16_t w, int16_t h,
+               uint16_t color, uint16_t bg, const uint8_t *bits) {
+  if ((w <= 0) || (h <= 0))
+    return 0;
+  size_t n = (size_t)((w + 7) / 8) * h;
+  int16_t a[] = {x, y, w, h, (int16_t)color, (int16_t)bg};
+  if (put(b, DSR_BITMAP, 6, a, n))
+    return -1;
+  memcpy(&b->buf[b->len], bits, n);
+  b->len += n;
+  return 0;
+}
+
+int dsr_scroll(dsr_buffer *b, int16_t x, int16_t y, int16_t w, int16_t h,
+               int16_t dx, int16_t dy, uint16_t color) {
+  int16_t a[] = {x, y, w, h, dx, dy, (int16_t)color};
+  return put(b, DSR_SCROLL, 7, a, 0);
+}
+
+int dsr_show(dsr_buffer *b) { return put(b, DSR_SHOW, 0, NULL, 0); }
+
+int dsr_brightness(dsr_buffer *b, uint8_t brightness) {
+  if (put(b, DSR_BRIGHTNESS, 0, NULL, 1))
+    return -1;
+  b->buf[b->len++] = brightness;
+  return 0;
+}
+
+int dsr_rotation(dsr_buffer *b, uint8_t rotation) {
+  if (put(b, DSR_ROTATION, 0, NULL, 1))
+    return -1;
+  b->buf[b->len++] = rotation;
+  return 0;
+}
@@ -0,0 +1,56 @@
+// THIS IS NOT ARDUINO CODE -- DON'T INCLUDE IN YOUR SKETCH.  It's a
+// small C library for host programs (PC, Raspberry Pi, etc.) that
+// encodes drawing commands for a matrix running the
+// Adafruit_DotStarMatrixRemote parser (see the "remote" example).
+// Commands are appended to a caller-supplied buffer, which the caller
+// then writes to the serial port -- typically once per frame, ending
+// with dsr_show().  A full-screen fill is 3 bytes and a line of text is
+// 11 bytes plus the characters, versus 3 bytes per pixel for raw frames.
+//
+// Usage:
+//   uint8_t mem[1024];
+//   dsr_buffer b;
+//   dsr_init(&b, mem, sizeof(mem));
+//   dsr_fill_screen(&b, 0);
+//   dsr_text(&b, 0, 0, dsr_color(255, 0, 0), 0, 1, "Hello");
+//   dsr_show(&b);
+//   write(serial_fd, b.buf, b.len);
+//
+// Each dsr_* function returns 0 on success, or -1 (and appends nothing)
+// if the command doesn't fit in the remaining buffer space.
+
+#ifndef _DSREMOTE_H_
+#define _DSREMOTE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+  uint8_t *buf; // Encoded commands
+  size_t size;  // Capacity of buf
+  size_t len;   // Bytes used so far
+} dsr_buffer;
+
+void dsr_init(dsr_buffer *b, uint8_t *mem, size_t size);
+void dsr_reset(dsr_buffer *b);
+uint16_t dsr_color(uint8_t r, uint8_t g, uint8_t b);
+
+int dsr_fill_rect(dsr_buffer *b, int16_t x, int16_t y, int16_t w, int16_t h,
+                  uint16_t color);
+int dsr_hline(dsr_buffer *b, int16_t x, int16_t y, int16_t w,
+              uint16_t color);
+int dsr_vline(dsr_buffer *b, int16_t x, int16_t y, int16_t h,
+              uint16_t color);
+int dsr_pixel(dsr_buffer *b, int16_t x, int16_t y, uint16_t color);
+int dsr_fill_screen(dsr_buffer *b, uint16_t color);
+int dsr_text(dsr_buffer *b, int16_t x, int16_t y, uint16_t color,
+             uint16_t bg, uint8_t size, const char *str);
+int dsr_bitmap(dsr_buffer *b, int16_t x, int16_t y, int16_t w, int16_t h,
+               uint16_t color, uint16_t bg, const uint8_t *bits);
+int dsr_scroll(dsr_buffer *b, int16_t x, int16_t y, int16_t w, int16_t h,
+               int16_t dx, int16_t dy, uint16_t color);
+int dsr_show(dsr_buffer *b);
+int dsr_brightness(dsr_buffer *b, uint8_t brightness);
+int dsr_rotation(dsr_buffer *b, uint8_t rotation);
+
+#endif // _DSREMOTE_H_